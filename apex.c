@@ -0,0 +1,142 @@
+/*
+ *  apex.c
+ *  libapex entry points, thin wrappers over the cpu.c internals
+ */
+#include <stdlib.h>
+
+#include "cpu.h"
+
+_Static_assert(APEX_COUNTER_CYCLE_CAUSES == NUM_CYCLE_CAUSES, "APEX_COUNTERS.cycle_stack out of sync with enum CYCLE_CAUSE");
+
+int
+apex_api_version(void)
+{
+	return APEX_API_VERSION;
+}
+
+APEX_CPU*
+apex_create_from_file(const char* filename)
+{
+	return APEX_cpu_init(filename);
+}
+
+APEX_CPU*
+apex_create_from_buffer(const char* text, size_t length)
+{
+	return APEX_cpu_init_buffer(text, length);
+}
+
+void
+apex_destroy(APEX_CPU* cpu)
+{
+	if (cpu) {
+		APEX_cpu_stop(cpu);
+	}
+}
+
+int
+apex_step(APEX_CPU* cpu, int cycles)
+{
+	int start = cpu->clock;
+	for (int i = 0; i < cycles; i++) {
+		if (APEX_cpu_cycle(cpu)) {
+			break;
+		}
+	}
+	return cpu->clock - start;
+}
+
+/*
+ * Common loop of the run calls: stop_pc < 0 and stop_commits < 0
+ * disable those conditions, HALT and max_cycles always apply.
+ */
+static enum APEX_STOP_REASON
+run_until(APEX_CPU* cpu, int stop_pc, int stop_commits, int max_cycles)
+{
+	int end = cpu->clock + max_cycles;
+	int target = cpu->ins_completed + stop_commits;
+	while (cpu->clock < end) {
+		int committed = cpu->ins_completed;
+		if (APEX_cpu_cycle(cpu)) {
+			return APEX_STOP_HALT;
+		}
+		if (cpu->ins_completed == committed) {
+			continue;
+		}
+		if (stop_pc >= 0 && cpu->last_commit_pc == stop_pc) {
+			return APEX_STOP_PC;
+		}
+		if (stop_commits >= 0 && cpu->ins_completed >= target) {
+			return APEX_STOP_COMMITS;
+		}
+	}
+	return cpu->halted ? APEX_STOP_HALT : APEX_STOP_CYCLES;
+}
+
+enum APEX_STOP_REASON
+apex_run_until_halt(APEX_CPU* cpu, int max_cycles)
+{
+	return run_until(cpu, -1, -1, max_cycles);
+}
+
+enum APEX_STOP_REASON
+apex_run_until_pc(APEX_CPU* cpu, int pc, int max_cycles)
+{
+	return run_until(cpu, pc, -1, max_cycles);
+}
+
+enum APEX_STOP_REASON
+apex_run_until_commits(APEX_CPU* cpu, int commits, int max_cycles)
+{
+	if (commits <= 0) {
+		return APEX_STOP_COMMITS;
+	}
+	return run_until(cpu, -1, commits, max_cycles);
+}
+
+void
+apex_get_counters(APEX_CPU* cpu, APEX_COUNTERS* counters)
+{
+	counters->cycles = cpu->clock;
+	counters->committed = cpu->ins_completed;
+	counters->branch_mispredicts = cpu->branch_mispredicts;
+	counters->halted = cpu->halted;
+	for (int i = 0; i < NUM_CYCLE_CAUSES; i++) {
+		counters->cycle_stack[i] = cpu->cycle_stack[i];
+	}
+}
+
+int
+apex_get_pc(APEX_CPU* cpu)
+{
+	return cpu->threads[0].pc;
+}
+
+int
+apex_get_register(APEX_CPU* cpu, int reg)
+{
+	if (reg < 0 || reg >= 16) {
+		return 0;
+	}
+	return cpu->threads[0].regs[reg];
+}
+
+int
+apex_read_memory(APEX_CPU* cpu, uint32_t address)
+{
+	return mem_read(&cpu->data_memory, address);
+}
+
+void
+apex_set_commit_hook(APEX_CPU* cpu, APEX_COMMIT_HOOK hook, void* user_data)
+{
+	cpu->commit_hook = hook;
+	cpu->commit_hook_data = user_data;
+}
+
+void
+apex_set_flush_hook(APEX_CPU* cpu, APEX_FLUSH_HOOK hook, void* user_data)
+{
+	cpu->flush_hook = hook;
+	cpu->flush_hook_data = user_data;
+}
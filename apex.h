@@ -0,0 +1,116 @@
+#ifndef _APEX_H_
+#define _APEX_H_
+/**
+ *  apex.h
+ *  Public C API of libapex, for driving the simulator in-process
+ *
+ *  The CPU is opaque: programs are loaded from a file or a buffer,
+ *  advanced with the step/run calls and inspected through the getters,
+ *  without any text output. Structures here only ever grow at the end,
+ *  and APEX_API_VERSION is bumped whenever something is added.
+ */
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define APEX_API_VERSION 1
+
+#if defined(__GNUC__)
+#define APEX_API __attribute__((visibility("default")))
+#else
+#define APEX_API
+#endif
+
+typedef struct APEX_CPU APEX_CPU;
+
+/* Why a run call returned */
+enum APEX_STOP_REASON
+{
+	APEX_STOP_CYCLES,	// Cycle limit reached
+	APEX_STOP_HALT,		// HALT committed
+	APEX_STOP_PC,		// Instruction at the requested PC committed
+	APEX_STOP_COMMITS	// Requested number of instructions committed
+};
+
+#define APEX_COUNTER_CYCLE_CAUSES 7
+
+typedef struct APEX_COUNTERS
+{
+	int cycles;
+	int committed;
+	int branch_mispredicts;
+	int halted;
+	/* CPI stack: commit, frontend, branch recovery, IQ wakeup, int pipe, mul pipe, memory */
+	int cycle_stack[APEX_COUNTER_CYCLE_CAUSES];
+} APEX_COUNTERS;
+
+typedef struct APEX_COMMIT_INFO
+{
+	int pc;
+	int cycle;
+	int arch_register;	// -1 for stores, branches and JUMP
+	int result;
+	const char* opcode;	// Only valid during the callback
+} APEX_COMMIT_INFO;
+
+/* Called once per committed instruction, from inside the cycle */
+typedef void (*APEX_COMMIT_HOOK)(void* user_data, const APEX_COMMIT_INFO* info);
+/* Called when a mispredicted branch or JUMP redirects fetch to target_pc */
+typedef void (*APEX_FLUSH_HOOK)(void* user_data, int branch_pc, int target_pc, int cycle);
+
+APEX_API int
+apex_api_version(void);
+
+APEX_API APEX_CPU*
+apex_create_from_file(const char* filename);
+
+/* text holds the same one instruction per line format as a program file */
+APEX_API APEX_CPU*
+apex_create_from_buffer(const char* text, size_t length);
+
+APEX_API void
+apex_destroy(APEX_CPU* cpu);
+
+/* Runs up to cycles cycles; returns how many ran, fewer once HALT commits */
+APEX_API int
+apex_step(APEX_CPU* cpu, int cycles);
+
+/* The run calls give up after max_cycles more cycles */
+APEX_API enum APEX_STOP_REASON
+apex_run_until_halt(APEX_CPU* cpu, int max_cycles);
+
+APEX_API enum APEX_STOP_REASON
+apex_run_until_pc(APEX_CPU* cpu, int pc, int max_cycles);
+
+/* Stops once commits more instructions have committed */
+APEX_API enum APEX_STOP_REASON
+apex_run_until_commits(APEX_CPU* cpu, int commits, int max_cycles);
+
+APEX_API void
+apex_get_counters(APEX_CPU* cpu, APEX_COUNTERS* counters);
+
+/* Next PC to be fetched */
+APEX_API int
+apex_get_pc(APEX_CPU* cpu);
+
+/* Committed architectural register value, 0 for an out of range register */
+APEX_API int
+apex_get_register(APEX_CPU* cpu, int reg);
+
+APEX_API int
+apex_read_memory(APEX_CPU* cpu, uint32_t address);
+
+APEX_API void
+apex_set_commit_hook(APEX_CPU* cpu, APEX_COMMIT_HOOK hook, void* user_data);
+
+APEX_API void
+apex_set_flush_hook(APEX_CPU* cpu, APEX_FLUSH_HOOK hook, void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
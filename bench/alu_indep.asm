@@ -0,0 +1,2067 @@
+MOVC,R0,#0
+MOVC,R1,#1
+MOVC,R2,#2
+MOVC,R3,#3
+MOVC,R4,#4
+MOVC,R5,#5
+MOVC,R6,#6
+MOVC,R7,#7
+MOVC,R8,#8
+MOVC,R9,#9
+MOVC,R10,#10
+MOVC,R11,#11
+MOVC,R12,#12
+MOVC,R13,#13
+MOVC,R14,#14
+MOVC,R15,#500
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+ADDL,R2,R10,#1
+ADDL,R3,R11,#1
+ADDL,R4,R12,#1
+ADDL,R5,R13,#1
+ADDL,R2,R10,#2
+ADDL,R3,R11,#2
+ADDL,R4,R12,#2
+ADDL,R5,R13,#2
+ADDL,R2,R10,#3
+ADDL,R3,R11,#3
+ADDL,R4,R12,#3
+ADDL,R5,R13,#3
+ADDL,R2,R10,#4
+ADDL,R3,R11,#4
+ADDL,R4,R12,#4
+ADDL,R5,R13,#4
+ADDL,R2,R10,#5
+ADDL,R3,R11,#5
+ADDL,R4,R12,#5
+ADDL,R5,R13,#5
+ADDL,R2,R10,#6
+ADDL,R3,R11,#6
+ADDL,R4,R12,#6
+ADDL,R5,R13,#6
+ADDL,R2,R10,#7
+ADDL,R3,R11,#7
+ADDL,R4,R12,#7
+ADDL,R5,R13,#7
+ADDL,R2,R10,#8
+ADDL,R3,R11,#8
+ADDL,R4,R12,#8
+ADDL,R5,R13,#8
+ADDL,R2,R10,#9
+ADDL,R3,R11,#9
+ADDL,R4,R12,#9
+ADDL,R5,R13,#9
+ADDL,R2,R10,#10
+ADDL,R3,R11,#10
+ADDL,R4,R12,#10
+ADDL,R5,R13,#10
+ADDL,R2,R10,#11
+ADDL,R3,R11,#11
+ADDL,R4,R12,#11
+ADDL,R5,R13,#11
+ADDL,R2,R10,#12
+ADDL,R3,R11,#12
+ADDL,R4,R12,#12
+ADDL,R5,R13,#12
+ADDL,R2,R10,#13
+ADDL,R3,R11,#13
+ADDL,R4,R12,#13
+ADDL,R5,R13,#13
+ADDL,R2,R10,#14
+ADDL,R3,R11,#14
+ADDL,R4,R12,#14
+ADDL,R5,R13,#14
+ADDL,R2,R10,#15
+ADDL,R3,R11,#15
+ADDL,R4,R12,#15
+ADDL,R5,R13,#15
+ADDL,R2,R10,#0
+ADDL,R3,R11,#0
+ADDL,R4,R12,#0
+ADDL,R5,R13,#0
+SUBL,R15,R15,#1
+BNZ,#-8196
+HALT
@@ -0,0 +1,2067 @@
+MOVC,R0,#0
+MOVC,R1,#1
+MOVC,R2,#2
+MOVC,R3,#3
+MOVC,R4,#4
+MOVC,R5,#5
+MOVC,R6,#6
+MOVC,R7,#7
+MOVC,R8,#8
+MOVC,R9,#9
+MOVC,R10,#10
+MOVC,R11,#11
+MOVC,R12,#12
+MOVC,R13,#13
+MOVC,R14,#14
+MOVC,R15,#300
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R6,R7,#1
+BNZ,#8
+ADDL,R8,R8,#1
+ADDL,R9,R9,#1
+SUBL,R15,R15,#1
+BNZ,#-8196
+HALT
@@ -0,0 +1,1555 @@
+MOVC,R0,#0
+MOVC,R1,#4000
+MOVC,R2,#2
+MOVC,R3,#3
+MOVC,R4,#4
+MOVC,R5,#5
+MOVC,R6,#6
+MOVC,R7,#7
+MOVC,R8,#8
+MOVC,R9,#9
+MOVC,R10,#10
+MOVC,R11,#11
+MOVC,R12,#12
+MOVC,R13,#13
+MOVC,R14,#14
+MOVC,R15,#400
+JUMP,R1,#72
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#84
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#96
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#108
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#120
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#132
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#144
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#156
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#168
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#180
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#192
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#204
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#216
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#228
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#240
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#252
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#264
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#276
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#288
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#300
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#312
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#324
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#336
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#348
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#360
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#372
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#384
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#396
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#408
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#420
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#432
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#444
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#456
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#468
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#480
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#492
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#504
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#516
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#528
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#540
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#552
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#564
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#576
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#588
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#600
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#612
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#624
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#636
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#648
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#660
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#672
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#684
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#696
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#708
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#720
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#732
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#744
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#756
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#768
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#780
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#792
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#804
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#816
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#828
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#840
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#852
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#864
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#876
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#888
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#900
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#912
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#924
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#936
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#948
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#960
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#972
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#984
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#996
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1008
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1020
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1032
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1044
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1056
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1068
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1080
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1092
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1104
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1116
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1128
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1140
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1152
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1164
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1176
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1188
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1200
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1212
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1224
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1236
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1248
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1260
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1272
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1284
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1296
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1308
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1320
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1332
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1344
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1356
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1368
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1380
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1392
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1404
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1416
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1428
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1440
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1452
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1464
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1476
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1488
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1500
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1512
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1524
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1536
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1548
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1560
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1572
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1584
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1596
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1608
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1620
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1632
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1644
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1656
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1668
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1680
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1692
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1704
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1716
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1728
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1740
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1752
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1764
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1776
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1788
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1800
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1812
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1824
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1836
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1848
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1860
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1872
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1884
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1896
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1908
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1920
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1932
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1944
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1956
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1968
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1980
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#1992
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2004
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2016
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2028
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2040
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2052
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2064
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2076
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2088
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2100
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2112
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2124
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2136
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2148
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2160
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2172
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2184
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2196
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2208
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2220
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2232
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2244
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2256
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2268
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2280
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2292
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2304
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2316
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2328
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2340
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2352
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2364
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2376
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2388
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2400
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2412
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2424
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2436
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2448
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2460
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2472
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2484
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2496
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2508
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2520
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2532
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2544
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2556
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2568
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2580
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2592
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2604
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2616
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2628
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2640
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2652
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2664
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2676
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2688
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2700
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2712
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2724
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2736
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2748
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2760
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2772
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2784
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2796
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2808
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2820
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2832
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2844
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2856
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2868
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2880
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2892
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2904
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2916
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2928
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2940
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2952
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2964
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2976
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#2988
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3000
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3012
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3024
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3036
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3048
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3060
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3072
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3084
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3096
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3108
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3120
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3132
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3144
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3156
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3168
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3180
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3192
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3204
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3216
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3228
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3240
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3252
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3264
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3276
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3288
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3300
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3312
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3324
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3336
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3348
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3360
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3372
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3384
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3396
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3408
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3420
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3432
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3444
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3456
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3468
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3480
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3492
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3504
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3516
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3528
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3540
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3552
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3564
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3576
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3588
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3600
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3612
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3624
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3636
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3648
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3660
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3672
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3684
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3696
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3708
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3720
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3732
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3744
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3756
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3768
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3780
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3792
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3804
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3816
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3828
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3840
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3852
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3864
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3876
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3888
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3900
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3912
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3924
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3936
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3948
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3960
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3972
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3984
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#3996
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4008
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4020
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4032
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4044
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4056
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4068
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4080
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4092
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4104
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4116
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4128
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4140
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4152
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4164
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4176
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4188
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4200
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4212
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4224
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4236
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4248
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4260
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4272
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4284
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4296
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4308
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4320
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4332
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4344
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4356
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4368
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4380
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4392
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4404
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4416
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4428
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4440
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4452
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4464
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4476
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4488
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4500
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4512
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4524
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4536
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4548
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4560
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4572
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4584
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4596
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4608
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4620
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4632
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4644
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4656
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4668
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4680
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4692
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4704
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4716
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4728
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4740
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4752
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4764
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4776
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4788
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4800
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4812
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4824
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4836
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4848
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4860
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4872
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4884
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4896
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4908
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4920
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4932
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4944
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4956
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4968
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4980
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#4992
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5004
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5016
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5028
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5040
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5052
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5064
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5076
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5088
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5100
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5112
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5124
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5136
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5148
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5160
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5172
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5184
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5196
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5208
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5220
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5232
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5244
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5256
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5268
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5280
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5292
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5304
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5316
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5328
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5340
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5352
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5364
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5376
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5388
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5400
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5412
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5424
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5436
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5448
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5460
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5472
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5484
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5496
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5508
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5520
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5532
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5544
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5556
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5568
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5580
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5592
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5604
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5616
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5628
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5640
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5652
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5664
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5676
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5688
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5700
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5712
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5724
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5736
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5748
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5760
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5772
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5784
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5796
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5808
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5820
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5832
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5844
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5856
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5868
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5880
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5892
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5904
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5916
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5928
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5940
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5952
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5964
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5976
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#5988
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6000
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6012
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6024
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6036
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6048
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6060
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6072
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6084
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6096
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6108
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6120
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6132
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6144
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6156
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6168
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6180
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6192
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+JUMP,R1,#6204
+ADDL,R2,R2,#99
+ADDL,R3,R3,#1
+SUBL,R15,R15,#1
+BNZ,#-6148
+HALT
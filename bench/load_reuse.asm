@@ -0,0 +1,13 @@
+MOVC,R1,#5000
+MOVC,R2,#64
+MOVC,R5,#0
+STORE,R1,R2,#0
+MOVC,R3,#25
+LOAD,R4,R2,#0
+MUL,R6,R4,R4
+ADD,R5,R5,R6
+SUBL,R3,R3,#1
+BNZ,#-16
+SUBL,R1,R1,#1
+BNZ,#-32
+HALT
@@ -0,0 +1,1043 @@
+MOVC,R0,#0
+MOVC,R1,#1
+MOVC,R2,#2
+MOVC,R3,#3
+MOVC,R4,#4
+MOVC,R5,#5
+MOVC,R6,#6
+MOVC,R7,#7
+MOVC,R8,#8
+MOVC,R9,#9
+MOVC,R10,#10
+MOVC,R11,#11
+MOVC,R12,#12
+MOVC,R13,#13
+MOVC,R14,#14
+MOVC,R15,#330
+STORE,R3,R0,#4
+LOAD,R11,R0,#4
+STORE,R4,R0,#8
+LOAD,R12,R0,#8
+STORE,R5,R0,#12
+LOAD,R13,R0,#12
+STORE,R6,R0,#16
+LOAD,R10,R0,#16
+STORE,R7,R0,#20
+LOAD,R11,R0,#20
+STORE,R8,R0,#24
+LOAD,R12,R0,#24
+STORE,R9,R0,#28
+LOAD,R13,R0,#28
+STORE,R2,R0,#32
+LOAD,R10,R0,#32
+STORE,R3,R0,#36
+LOAD,R11,R0,#36
+STORE,R4,R0,#40
+LOAD,R12,R0,#40
+STORE,R5,R0,#44
+LOAD,R13,R0,#44
+STORE,R6,R0,#48
+LOAD,R10,R0,#48
+STORE,R7,R0,#52
+LOAD,R11,R0,#52
+STORE,R8,R0,#56
+LOAD,R12,R0,#56
+STORE,R9,R0,#60
+LOAD,R13,R0,#60
+STORE,R2,R0,#64
+LOAD,R10,R0,#64
+STORE,R3,R0,#68
+LOAD,R11,R0,#68
+STORE,R4,R0,#72
+LOAD,R12,R0,#72
+STORE,R5,R0,#76
+LOAD,R13,R0,#76
+STORE,R6,R0,#80
+LOAD,R10,R0,#80
+STORE,R7,R0,#84
+LOAD,R11,R0,#84
+STORE,R8,R0,#88
+LOAD,R12,R0,#88
+STORE,R9,R0,#92
+LOAD,R13,R0,#92
+STORE,R2,R0,#96
+LOAD,R10,R0,#96
+STORE,R3,R0,#100
+LOAD,R11,R0,#100
+STORE,R4,R0,#104
+LOAD,R12,R0,#104
+STORE,R5,R0,#108
+LOAD,R13,R0,#108
+STORE,R6,R0,#112
+LOAD,R10,R0,#112
+STORE,R7,R0,#116
+LOAD,R11,R0,#116
+STORE,R8,R0,#120
+LOAD,R12,R0,#120
+STORE,R9,R0,#124
+LOAD,R13,R0,#124
+STORE,R2,R0,#128
+LOAD,R10,R0,#128
+STORE,R3,R0,#132
+LOAD,R11,R0,#132
+STORE,R4,R0,#136
+LOAD,R12,R0,#136
+STORE,R5,R0,#140
+LOAD,R13,R0,#140
+STORE,R6,R0,#144
+LOAD,R10,R0,#144
+STORE,R7,R0,#148
+LOAD,R11,R0,#148
+STORE,R8,R0,#152
+LOAD,R12,R0,#152
+STORE,R9,R0,#156
+LOAD,R13,R0,#156
+STORE,R2,R0,#160
+LOAD,R10,R0,#160
+STORE,R3,R0,#164
+LOAD,R11,R0,#164
+STORE,R4,R0,#168
+LOAD,R12,R0,#168
+STORE,R5,R0,#172
+LOAD,R13,R0,#172
+STORE,R6,R0,#176
+LOAD,R10,R0,#176
+STORE,R7,R0,#180
+LOAD,R11,R0,#180
+STORE,R8,R0,#184
+LOAD,R12,R0,#184
+STORE,R9,R0,#188
+LOAD,R13,R0,#188
+STORE,R2,R0,#192
+LOAD,R10,R0,#192
+STORE,R3,R0,#196
+LOAD,R11,R0,#196
+STORE,R4,R0,#200
+LOAD,R12,R0,#200
+STORE,R5,R0,#204
+LOAD,R13,R0,#204
+STORE,R6,R0,#208
+LOAD,R10,R0,#208
+STORE,R7,R0,#212
+LOAD,R11,R0,#212
+STORE,R8,R0,#216
+LOAD,R12,R0,#216
+STORE,R9,R0,#220
+LOAD,R13,R0,#220
+STORE,R2,R0,#224
+LOAD,R10,R0,#224
+STORE,R3,R0,#228
+LOAD,R11,R0,#228
+STORE,R4,R0,#232
+LOAD,R12,R0,#232
+STORE,R5,R0,#236
+LOAD,R13,R0,#236
+STORE,R6,R0,#240
+LOAD,R10,R0,#240
+STORE,R7,R0,#244
+LOAD,R11,R0,#244
+STORE,R8,R0,#248
+LOAD,R12,R0,#248
+STORE,R9,R0,#252
+LOAD,R13,R0,#252
+STORE,R2,R0,#256
+LOAD,R10,R0,#256
+STORE,R3,R0,#260
+LOAD,R11,R0,#260
+STORE,R4,R0,#264
+LOAD,R12,R0,#264
+STORE,R5,R0,#268
+LOAD,R13,R0,#268
+STORE,R6,R0,#272
+LOAD,R10,R0,#272
+STORE,R7,R0,#276
+LOAD,R11,R0,#276
+STORE,R8,R0,#280
+LOAD,R12,R0,#280
+STORE,R9,R0,#284
+LOAD,R13,R0,#284
+STORE,R2,R0,#288
+LOAD,R10,R0,#288
+STORE,R3,R0,#292
+LOAD,R11,R0,#292
+STORE,R4,R0,#296
+LOAD,R12,R0,#296
+STORE,R5,R0,#300
+LOAD,R13,R0,#300
+STORE,R6,R0,#304
+LOAD,R10,R0,#304
+STORE,R7,R0,#308
+LOAD,R11,R0,#308
+STORE,R8,R0,#312
+LOAD,R12,R0,#312
+STORE,R9,R0,#316
+LOAD,R13,R0,#316
+STORE,R2,R0,#320
+LOAD,R10,R0,#320
+STORE,R3,R0,#324
+LOAD,R11,R0,#324
+STORE,R4,R0,#328
+LOAD,R12,R0,#328
+STORE,R5,R0,#332
+LOAD,R13,R0,#332
+STORE,R6,R0,#336
+LOAD,R10,R0,#336
+STORE,R7,R0,#340
+LOAD,R11,R0,#340
+STORE,R8,R0,#344
+LOAD,R12,R0,#344
+STORE,R9,R0,#348
+LOAD,R13,R0,#348
+STORE,R2,R0,#352
+LOAD,R10,R0,#352
+STORE,R3,R0,#356
+LOAD,R11,R0,#356
+STORE,R4,R0,#360
+LOAD,R12,R0,#360
+STORE,R5,R0,#364
+LOAD,R13,R0,#364
+STORE,R6,R0,#368
+LOAD,R10,R0,#368
+STORE,R7,R0,#372
+LOAD,R11,R0,#372
+STORE,R8,R0,#376
+LOAD,R12,R0,#376
+STORE,R9,R0,#380
+LOAD,R13,R0,#380
+STORE,R2,R0,#384
+LOAD,R10,R0,#384
+STORE,R3,R0,#388
+LOAD,R11,R0,#388
+STORE,R4,R0,#392
+LOAD,R12,R0,#392
+STORE,R5,R0,#396
+LOAD,R13,R0,#396
+STORE,R6,R0,#400
+LOAD,R10,R0,#400
+STORE,R7,R0,#404
+LOAD,R11,R0,#404
+STORE,R8,R0,#408
+LOAD,R12,R0,#408
+STORE,R9,R0,#412
+LOAD,R13,R0,#412
+STORE,R2,R0,#416
+LOAD,R10,R0,#416
+STORE,R3,R0,#420
+LOAD,R11,R0,#420
+STORE,R4,R0,#424
+LOAD,R12,R0,#424
+STORE,R5,R0,#428
+LOAD,R13,R0,#428
+STORE,R6,R0,#432
+LOAD,R10,R0,#432
+STORE,R7,R0,#436
+LOAD,R11,R0,#436
+STORE,R8,R0,#440
+LOAD,R12,R0,#440
+STORE,R9,R0,#444
+LOAD,R13,R0,#444
+STORE,R2,R0,#448
+LOAD,R10,R0,#448
+STORE,R3,R0,#452
+LOAD,R11,R0,#452
+STORE,R4,R0,#456
+LOAD,R12,R0,#456
+STORE,R5,R0,#460
+LOAD,R13,R0,#460
+STORE,R6,R0,#464
+LOAD,R10,R0,#464
+STORE,R7,R0,#468
+LOAD,R11,R0,#468
+STORE,R8,R0,#472
+LOAD,R12,R0,#472
+STORE,R9,R0,#476
+LOAD,R13,R0,#476
+STORE,R2,R0,#480
+LOAD,R10,R0,#480
+STORE,R3,R0,#484
+LOAD,R11,R0,#484
+STORE,R4,R0,#488
+LOAD,R12,R0,#488
+STORE,R5,R0,#492
+LOAD,R13,R0,#492
+STORE,R6,R0,#496
+LOAD,R10,R0,#496
+STORE,R7,R0,#500
+LOAD,R11,R0,#500
+STORE,R8,R0,#504
+LOAD,R12,R0,#504
+STORE,R9,R0,#508
+LOAD,R13,R0,#508
+STORE,R2,R0,#512
+LOAD,R10,R0,#512
+STORE,R3,R0,#516
+LOAD,R11,R0,#516
+STORE,R4,R0,#520
+LOAD,R12,R0,#520
+STORE,R5,R0,#524
+LOAD,R13,R0,#524
+STORE,R6,R0,#528
+LOAD,R10,R0,#528
+STORE,R7,R0,#532
+LOAD,R11,R0,#532
+STORE,R8,R0,#536
+LOAD,R12,R0,#536
+STORE,R9,R0,#540
+LOAD,R13,R0,#540
+STORE,R2,R0,#544
+LOAD,R10,R0,#544
+STORE,R3,R0,#548
+LOAD,R11,R0,#548
+STORE,R4,R0,#552
+LOAD,R12,R0,#552
+STORE,R5,R0,#556
+LOAD,R13,R0,#556
+STORE,R6,R0,#560
+LOAD,R10,R0,#560
+STORE,R7,R0,#564
+LOAD,R11,R0,#564
+STORE,R8,R0,#568
+LOAD,R12,R0,#568
+STORE,R9,R0,#572
+LOAD,R13,R0,#572
+STORE,R2,R0,#576
+LOAD,R10,R0,#576
+STORE,R3,R0,#580
+LOAD,R11,R0,#580
+STORE,R4,R0,#584
+LOAD,R12,R0,#584
+STORE,R5,R0,#588
+LOAD,R13,R0,#588
+STORE,R6,R0,#592
+LOAD,R10,R0,#592
+STORE,R7,R0,#596
+LOAD,R11,R0,#596
+STORE,R8,R0,#600
+LOAD,R12,R0,#600
+STORE,R9,R0,#604
+LOAD,R13,R0,#604
+STORE,R2,R0,#608
+LOAD,R10,R0,#608
+STORE,R3,R0,#612
+LOAD,R11,R0,#612
+STORE,R4,R0,#616
+LOAD,R12,R0,#616
+STORE,R5,R0,#620
+LOAD,R13,R0,#620
+STORE,R6,R0,#624
+LOAD,R10,R0,#624
+STORE,R7,R0,#628
+LOAD,R11,R0,#628
+STORE,R8,R0,#632
+LOAD,R12,R0,#632
+STORE,R9,R0,#636
+LOAD,R13,R0,#636
+STORE,R2,R0,#640
+LOAD,R10,R0,#640
+STORE,R3,R0,#644
+LOAD,R11,R0,#644
+STORE,R4,R0,#648
+LOAD,R12,R0,#648
+STORE,R5,R0,#652
+LOAD,R13,R0,#652
+STORE,R6,R0,#656
+LOAD,R10,R0,#656
+STORE,R7,R0,#660
+LOAD,R11,R0,#660
+STORE,R8,R0,#664
+LOAD,R12,R0,#664
+STORE,R9,R0,#668
+LOAD,R13,R0,#668
+STORE,R2,R0,#672
+LOAD,R10,R0,#672
+STORE,R3,R0,#676
+LOAD,R11,R0,#676
+STORE,R4,R0,#680
+LOAD,R12,R0,#680
+STORE,R5,R0,#684
+LOAD,R13,R0,#684
+STORE,R6,R0,#688
+LOAD,R10,R0,#688
+STORE,R7,R0,#692
+LOAD,R11,R0,#692
+STORE,R8,R0,#696
+LOAD,R12,R0,#696
+STORE,R9,R0,#700
+LOAD,R13,R0,#700
+STORE,R2,R0,#704
+LOAD,R10,R0,#704
+STORE,R3,R0,#708
+LOAD,R11,R0,#708
+STORE,R4,R0,#712
+LOAD,R12,R0,#712
+STORE,R5,R0,#716
+LOAD,R13,R0,#716
+STORE,R6,R0,#720
+LOAD,R10,R0,#720
+STORE,R7,R0,#724
+LOAD,R11,R0,#724
+STORE,R8,R0,#728
+LOAD,R12,R0,#728
+STORE,R9,R0,#732
+LOAD,R13,R0,#732
+STORE,R2,R0,#736
+LOAD,R10,R0,#736
+STORE,R3,R0,#740
+LOAD,R11,R0,#740
+STORE,R4,R0,#744
+LOAD,R12,R0,#744
+STORE,R5,R0,#748
+LOAD,R13,R0,#748
+STORE,R6,R0,#752
+LOAD,R10,R0,#752
+STORE,R7,R0,#756
+LOAD,R11,R0,#756
+STORE,R8,R0,#760
+LOAD,R12,R0,#760
+STORE,R9,R0,#764
+LOAD,R13,R0,#764
+STORE,R2,R0,#768
+LOAD,R10,R0,#768
+STORE,R3,R0,#772
+LOAD,R11,R0,#772
+STORE,R4,R0,#776
+LOAD,R12,R0,#776
+STORE,R5,R0,#780
+LOAD,R13,R0,#780
+STORE,R6,R0,#784
+LOAD,R10,R0,#784
+STORE,R7,R0,#788
+LOAD,R11,R0,#788
+STORE,R8,R0,#792
+LOAD,R12,R0,#792
+STORE,R9,R0,#796
+LOAD,R13,R0,#796
+STORE,R2,R0,#800
+LOAD,R10,R0,#800
+STORE,R3,R0,#804
+LOAD,R11,R0,#804
+STORE,R4,R0,#808
+LOAD,R12,R0,#808
+STORE,R5,R0,#812
+LOAD,R13,R0,#812
+STORE,R6,R0,#816
+LOAD,R10,R0,#816
+STORE,R7,R0,#820
+LOAD,R11,R0,#820
+STORE,R8,R0,#824
+LOAD,R12,R0,#824
+STORE,R9,R0,#828
+LOAD,R13,R0,#828
+STORE,R2,R0,#832
+LOAD,R10,R0,#832
+STORE,R3,R0,#836
+LOAD,R11,R0,#836
+STORE,R4,R0,#840
+LOAD,R12,R0,#840
+STORE,R5,R0,#844
+LOAD,R13,R0,#844
+STORE,R6,R0,#848
+LOAD,R10,R0,#848
+STORE,R7,R0,#852
+LOAD,R11,R0,#852
+STORE,R8,R0,#856
+LOAD,R12,R0,#856
+STORE,R9,R0,#860
+LOAD,R13,R0,#860
+STORE,R2,R0,#864
+LOAD,R10,R0,#864
+STORE,R3,R0,#868
+LOAD,R11,R0,#868
+STORE,R4,R0,#872
+LOAD,R12,R0,#872
+STORE,R5,R0,#876
+LOAD,R13,R0,#876
+STORE,R6,R0,#880
+LOAD,R10,R0,#880
+STORE,R7,R0,#884
+LOAD,R11,R0,#884
+STORE,R8,R0,#888
+LOAD,R12,R0,#888
+STORE,R9,R0,#892
+LOAD,R13,R0,#892
+STORE,R2,R0,#896
+LOAD,R10,R0,#896
+STORE,R3,R0,#900
+LOAD,R11,R0,#900
+STORE,R4,R0,#904
+LOAD,R12,R0,#904
+STORE,R5,R0,#908
+LOAD,R13,R0,#908
+STORE,R6,R0,#912
+LOAD,R10,R0,#912
+STORE,R7,R0,#916
+LOAD,R11,R0,#916
+STORE,R8,R0,#920
+LOAD,R12,R0,#920
+STORE,R9,R0,#924
+LOAD,R13,R0,#924
+STORE,R2,R0,#928
+LOAD,R10,R0,#928
+STORE,R3,R0,#932
+LOAD,R11,R0,#932
+STORE,R4,R0,#936
+LOAD,R12,R0,#936
+STORE,R5,R0,#940
+LOAD,R13,R0,#940
+STORE,R6,R0,#944
+LOAD,R10,R0,#944
+STORE,R7,R0,#948
+LOAD,R11,R0,#948
+STORE,R8,R0,#952
+LOAD,R12,R0,#952
+STORE,R9,R0,#956
+LOAD,R13,R0,#956
+STORE,R2,R0,#960
+LOAD,R10,R0,#960
+STORE,R3,R0,#964
+LOAD,R11,R0,#964
+STORE,R4,R0,#968
+LOAD,R12,R0,#968
+STORE,R5,R0,#972
+LOAD,R13,R0,#972
+STORE,R6,R0,#976
+LOAD,R10,R0,#976
+STORE,R7,R0,#980
+LOAD,R11,R0,#980
+STORE,R8,R0,#984
+LOAD,R12,R0,#984
+STORE,R9,R0,#988
+LOAD,R13,R0,#988
+STORE,R2,R0,#992
+LOAD,R10,R0,#992
+STORE,R3,R0,#996
+LOAD,R11,R0,#996
+STORE,R4,R0,#1000
+LOAD,R12,R0,#1000
+STORE,R5,R0,#1004
+LOAD,R13,R0,#1004
+STORE,R6,R0,#1008
+LOAD,R10,R0,#1008
+STORE,R7,R0,#1012
+LOAD,R11,R0,#1012
+STORE,R8,R0,#1016
+LOAD,R12,R0,#1016
+STORE,R9,R0,#1020
+LOAD,R13,R0,#1020
+STORE,R2,R0,#1024
+LOAD,R10,R0,#1024
+STORE,R3,R0,#1028
+LOAD,R11,R0,#1028
+STORE,R4,R0,#1032
+LOAD,R12,R0,#1032
+STORE,R5,R0,#1036
+LOAD,R13,R0,#1036
+STORE,R6,R0,#1040
+LOAD,R10,R0,#1040
+STORE,R7,R0,#1044
+LOAD,R11,R0,#1044
+STORE,R8,R0,#1048
+LOAD,R12,R0,#1048
+STORE,R9,R0,#1052
+LOAD,R13,R0,#1052
+STORE,R2,R0,#1056
+LOAD,R10,R0,#1056
+STORE,R3,R0,#1060
+LOAD,R11,R0,#1060
+STORE,R4,R0,#1064
+LOAD,R12,R0,#1064
+STORE,R5,R0,#1068
+LOAD,R13,R0,#1068
+STORE,R6,R0,#1072
+LOAD,R10,R0,#1072
+STORE,R7,R0,#1076
+LOAD,R11,R0,#1076
+STORE,R8,R0,#1080
+LOAD,R12,R0,#1080
+STORE,R9,R0,#1084
+LOAD,R13,R0,#1084
+STORE,R2,R0,#1088
+LOAD,R10,R0,#1088
+STORE,R3,R0,#1092
+LOAD,R11,R0,#1092
+STORE,R4,R0,#1096
+LOAD,R12,R0,#1096
+STORE,R5,R0,#1100
+LOAD,R13,R0,#1100
+STORE,R6,R0,#1104
+LOAD,R10,R0,#1104
+STORE,R7,R0,#1108
+LOAD,R11,R0,#1108
+STORE,R8,R0,#1112
+LOAD,R12,R0,#1112
+STORE,R9,R0,#1116
+LOAD,R13,R0,#1116
+STORE,R2,R0,#1120
+LOAD,R10,R0,#1120
+STORE,R3,R0,#1124
+LOAD,R11,R0,#1124
+STORE,R4,R0,#1128
+LOAD,R12,R0,#1128
+STORE,R5,R0,#1132
+LOAD,R13,R0,#1132
+STORE,R6,R0,#1136
+LOAD,R10,R0,#1136
+STORE,R7,R0,#1140
+LOAD,R11,R0,#1140
+STORE,R8,R0,#1144
+LOAD,R12,R0,#1144
+STORE,R9,R0,#1148
+LOAD,R13,R0,#1148
+STORE,R2,R0,#1152
+LOAD,R10,R0,#1152
+STORE,R3,R0,#1156
+LOAD,R11,R0,#1156
+STORE,R4,R0,#1160
+LOAD,R12,R0,#1160
+STORE,R5,R0,#1164
+LOAD,R13,R0,#1164
+STORE,R6,R0,#1168
+LOAD,R10,R0,#1168
+STORE,R7,R0,#1172
+LOAD,R11,R0,#1172
+STORE,R8,R0,#1176
+LOAD,R12,R0,#1176
+STORE,R9,R0,#1180
+LOAD,R13,R0,#1180
+STORE,R2,R0,#1184
+LOAD,R10,R0,#1184
+STORE,R3,R0,#1188
+LOAD,R11,R0,#1188
+STORE,R4,R0,#1192
+LOAD,R12,R0,#1192
+STORE,R5,R0,#1196
+LOAD,R13,R0,#1196
+STORE,R6,R0,#1200
+LOAD,R10,R0,#1200
+STORE,R7,R0,#1204
+LOAD,R11,R0,#1204
+STORE,R8,R0,#1208
+LOAD,R12,R0,#1208
+STORE,R9,R0,#1212
+LOAD,R13,R0,#1212
+STORE,R2,R0,#1216
+LOAD,R10,R0,#1216
+STORE,R3,R0,#1220
+LOAD,R11,R0,#1220
+STORE,R4,R0,#1224
+LOAD,R12,R0,#1224
+STORE,R5,R0,#1228
+LOAD,R13,R0,#1228
+STORE,R6,R0,#1232
+LOAD,R10,R0,#1232
+STORE,R7,R0,#1236
+LOAD,R11,R0,#1236
+STORE,R8,R0,#1240
+LOAD,R12,R0,#1240
+STORE,R9,R0,#1244
+LOAD,R13,R0,#1244
+STORE,R2,R0,#1248
+LOAD,R10,R0,#1248
+STORE,R3,R0,#1252
+LOAD,R11,R0,#1252
+STORE,R4,R0,#1256
+LOAD,R12,R0,#1256
+STORE,R5,R0,#1260
+LOAD,R13,R0,#1260
+STORE,R6,R0,#1264
+LOAD,R10,R0,#1264
+STORE,R7,R0,#1268
+LOAD,R11,R0,#1268
+STORE,R8,R0,#1272
+LOAD,R12,R0,#1272
+STORE,R9,R0,#1276
+LOAD,R13,R0,#1276
+STORE,R2,R0,#1280
+LOAD,R10,R0,#1280
+STORE,R3,R0,#1284
+LOAD,R11,R0,#1284
+STORE,R4,R0,#1288
+LOAD,R12,R0,#1288
+STORE,R5,R0,#1292
+LOAD,R13,R0,#1292
+STORE,R6,R0,#1296
+LOAD,R10,R0,#1296
+STORE,R7,R0,#1300
+LOAD,R11,R0,#1300
+STORE,R8,R0,#1304
+LOAD,R12,R0,#1304
+STORE,R9,R0,#1308
+LOAD,R13,R0,#1308
+STORE,R2,R0,#1312
+LOAD,R10,R0,#1312
+STORE,R3,R0,#1316
+LOAD,R11,R0,#1316
+STORE,R4,R0,#1320
+LOAD,R12,R0,#1320
+STORE,R5,R0,#1324
+LOAD,R13,R0,#1324
+STORE,R6,R0,#1328
+LOAD,R10,R0,#1328
+STORE,R7,R0,#1332
+LOAD,R11,R0,#1332
+STORE,R8,R0,#1336
+LOAD,R12,R0,#1336
+STORE,R9,R0,#1340
+LOAD,R13,R0,#1340
+STORE,R2,R0,#1344
+LOAD,R10,R0,#1344
+STORE,R3,R0,#1348
+LOAD,R11,R0,#1348
+STORE,R4,R0,#1352
+LOAD,R12,R0,#1352
+STORE,R5,R0,#1356
+LOAD,R13,R0,#1356
+STORE,R6,R0,#1360
+LOAD,R10,R0,#1360
+STORE,R7,R0,#1364
+LOAD,R11,R0,#1364
+STORE,R8,R0,#1368
+LOAD,R12,R0,#1368
+STORE,R9,R0,#1372
+LOAD,R13,R0,#1372
+STORE,R2,R0,#1376
+LOAD,R10,R0,#1376
+STORE,R3,R0,#1380
+LOAD,R11,R0,#1380
+STORE,R4,R0,#1384
+LOAD,R12,R0,#1384
+STORE,R5,R0,#1388
+LOAD,R13,R0,#1388
+STORE,R6,R0,#1392
+LOAD,R10,R0,#1392
+STORE,R7,R0,#1396
+LOAD,R11,R0,#1396
+STORE,R8,R0,#1400
+LOAD,R12,R0,#1400
+STORE,R9,R0,#1404
+LOAD,R13,R0,#1404
+STORE,R2,R0,#1408
+LOAD,R10,R0,#1408
+STORE,R3,R0,#1412
+LOAD,R11,R0,#1412
+STORE,R4,R0,#1416
+LOAD,R12,R0,#1416
+STORE,R5,R0,#1420
+LOAD,R13,R0,#1420
+STORE,R6,R0,#1424
+LOAD,R10,R0,#1424
+STORE,R7,R0,#1428
+LOAD,R11,R0,#1428
+STORE,R8,R0,#1432
+LOAD,R12,R0,#1432
+STORE,R9,R0,#1436
+LOAD,R13,R0,#1436
+STORE,R2,R0,#1440
+LOAD,R10,R0,#1440
+STORE,R3,R0,#1444
+LOAD,R11,R0,#1444
+STORE,R4,R0,#1448
+LOAD,R12,R0,#1448
+STORE,R5,R0,#1452
+LOAD,R13,R0,#1452
+STORE,R6,R0,#1456
+LOAD,R10,R0,#1456
+STORE,R7,R0,#1460
+LOAD,R11,R0,#1460
+STORE,R8,R0,#1464
+LOAD,R12,R0,#1464
+STORE,R9,R0,#1468
+LOAD,R13,R0,#1468
+STORE,R2,R0,#1472
+LOAD,R10,R0,#1472
+STORE,R3,R0,#1476
+LOAD,R11,R0,#1476
+STORE,R4,R0,#1480
+LOAD,R12,R0,#1480
+STORE,R5,R0,#1484
+LOAD,R13,R0,#1484
+STORE,R6,R0,#1488
+LOAD,R10,R0,#1488
+STORE,R7,R0,#1492
+LOAD,R11,R0,#1492
+STORE,R8,R0,#1496
+LOAD,R12,R0,#1496
+STORE,R9,R0,#1500
+LOAD,R13,R0,#1500
+STORE,R2,R0,#1504
+LOAD,R10,R0,#1504
+STORE,R3,R0,#1508
+LOAD,R11,R0,#1508
+STORE,R4,R0,#1512
+LOAD,R12,R0,#1512
+STORE,R5,R0,#1516
+LOAD,R13,R0,#1516
+STORE,R6,R0,#1520
+LOAD,R10,R0,#1520
+STORE,R7,R0,#1524
+LOAD,R11,R0,#1524
+STORE,R8,R0,#1528
+LOAD,R12,R0,#1528
+STORE,R9,R0,#1532
+LOAD,R13,R0,#1532
+STORE,R2,R0,#1536
+LOAD,R10,R0,#1536
+STORE,R3,R0,#1540
+LOAD,R11,R0,#1540
+STORE,R4,R0,#1544
+LOAD,R12,R0,#1544
+STORE,R5,R0,#1548
+LOAD,R13,R0,#1548
+STORE,R6,R0,#1552
+LOAD,R10,R0,#1552
+STORE,R7,R0,#1556
+LOAD,R11,R0,#1556
+STORE,R8,R0,#1560
+LOAD,R12,R0,#1560
+STORE,R9,R0,#1564
+LOAD,R13,R0,#1564
+STORE,R2,R0,#1568
+LOAD,R10,R0,#1568
+STORE,R3,R0,#1572
+LOAD,R11,R0,#1572
+STORE,R4,R0,#1576
+LOAD,R12,R0,#1576
+STORE,R5,R0,#1580
+LOAD,R13,R0,#1580
+STORE,R6,R0,#1584
+LOAD,R10,R0,#1584
+STORE,R7,R0,#1588
+LOAD,R11,R0,#1588
+STORE,R8,R0,#1592
+LOAD,R12,R0,#1592
+STORE,R9,R0,#1596
+LOAD,R13,R0,#1596
+STORE,R2,R0,#1600
+LOAD,R10,R0,#1600
+STORE,R3,R0,#1604
+LOAD,R11,R0,#1604
+STORE,R4,R0,#1608
+LOAD,R12,R0,#1608
+STORE,R5,R0,#1612
+LOAD,R13,R0,#1612
+STORE,R6,R0,#1616
+LOAD,R10,R0,#1616
+STORE,R7,R0,#1620
+LOAD,R11,R0,#1620
+STORE,R8,R0,#1624
+LOAD,R12,R0,#1624
+STORE,R9,R0,#1628
+LOAD,R13,R0,#1628
+STORE,R2,R0,#1632
+LOAD,R10,R0,#1632
+STORE,R3,R0,#1636
+LOAD,R11,R0,#1636
+STORE,R4,R0,#1640
+LOAD,R12,R0,#1640
+STORE,R5,R0,#1644
+LOAD,R13,R0,#1644
+STORE,R6,R0,#1648
+LOAD,R10,R0,#1648
+STORE,R7,R0,#1652
+LOAD,R11,R0,#1652
+STORE,R8,R0,#1656
+LOAD,R12,R0,#1656
+STORE,R9,R0,#1660
+LOAD,R13,R0,#1660
+STORE,R2,R0,#1664
+LOAD,R10,R0,#1664
+STORE,R3,R0,#1668
+LOAD,R11,R0,#1668
+STORE,R4,R0,#1672
+LOAD,R12,R0,#1672
+STORE,R5,R0,#1676
+LOAD,R13,R0,#1676
+STORE,R6,R0,#1680
+LOAD,R10,R0,#1680
+STORE,R7,R0,#1684
+LOAD,R11,R0,#1684
+STORE,R8,R0,#1688
+LOAD,R12,R0,#1688
+STORE,R9,R0,#1692
+LOAD,R13,R0,#1692
+STORE,R2,R0,#1696
+LOAD,R10,R0,#1696
+STORE,R3,R0,#1700
+LOAD,R11,R0,#1700
+STORE,R4,R0,#1704
+LOAD,R12,R0,#1704
+STORE,R5,R0,#1708
+LOAD,R13,R0,#1708
+STORE,R6,R0,#1712
+LOAD,R10,R0,#1712
+STORE,R7,R0,#1716
+LOAD,R11,R0,#1716
+STORE,R8,R0,#1720
+LOAD,R12,R0,#1720
+STORE,R9,R0,#1724
+LOAD,R13,R0,#1724
+STORE,R2,R0,#1728
+LOAD,R10,R0,#1728
+STORE,R3,R0,#1732
+LOAD,R11,R0,#1732
+STORE,R4,R0,#1736
+LOAD,R12,R0,#1736
+STORE,R5,R0,#1740
+LOAD,R13,R0,#1740
+STORE,R6,R0,#1744
+LOAD,R10,R0,#1744
+STORE,R7,R0,#1748
+LOAD,R11,R0,#1748
+STORE,R8,R0,#1752
+LOAD,R12,R0,#1752
+STORE,R9,R0,#1756
+LOAD,R13,R0,#1756
+STORE,R2,R0,#1760
+LOAD,R10,R0,#1760
+STORE,R3,R0,#1764
+LOAD,R11,R0,#1764
+STORE,R4,R0,#1768
+LOAD,R12,R0,#1768
+STORE,R5,R0,#1772
+LOAD,R13,R0,#1772
+STORE,R6,R0,#1776
+LOAD,R10,R0,#1776
+STORE,R7,R0,#1780
+LOAD,R11,R0,#1780
+STORE,R8,R0,#1784
+LOAD,R12,R0,#1784
+STORE,R9,R0,#1788
+LOAD,R13,R0,#1788
+STORE,R2,R0,#1792
+LOAD,R10,R0,#1792
+STORE,R3,R0,#1796
+LOAD,R11,R0,#1796
+STORE,R4,R0,#1800
+LOAD,R12,R0,#1800
+STORE,R5,R0,#1804
+LOAD,R13,R0,#1804
+STORE,R6,R0,#1808
+LOAD,R10,R0,#1808
+STORE,R7,R0,#1812
+LOAD,R11,R0,#1812
+STORE,R8,R0,#1816
+LOAD,R12,R0,#1816
+STORE,R9,R0,#1820
+LOAD,R13,R0,#1820
+STORE,R2,R0,#1824
+LOAD,R10,R0,#1824
+STORE,R3,R0,#1828
+LOAD,R11,R0,#1828
+STORE,R4,R0,#1832
+LOAD,R12,R0,#1832
+STORE,R5,R0,#1836
+LOAD,R13,R0,#1836
+STORE,R6,R0,#1840
+LOAD,R10,R0,#1840
+STORE,R7,R0,#1844
+LOAD,R11,R0,#1844
+STORE,R8,R0,#1848
+LOAD,R12,R0,#1848
+STORE,R9,R0,#1852
+LOAD,R13,R0,#1852
+STORE,R2,R0,#1856
+LOAD,R10,R0,#1856
+STORE,R3,R0,#1860
+LOAD,R11,R0,#1860
+STORE,R4,R0,#1864
+LOAD,R12,R0,#1864
+STORE,R5,R0,#1868
+LOAD,R13,R0,#1868
+STORE,R6,R0,#1872
+LOAD,R10,R0,#1872
+STORE,R7,R0,#1876
+LOAD,R11,R0,#1876
+STORE,R8,R0,#1880
+LOAD,R12,R0,#1880
+STORE,R9,R0,#1884
+LOAD,R13,R0,#1884
+STORE,R2,R0,#1888
+LOAD,R10,R0,#1888
+STORE,R3,R0,#1892
+LOAD,R11,R0,#1892
+STORE,R4,R0,#1896
+LOAD,R12,R0,#1896
+STORE,R5,R0,#1900
+LOAD,R13,R0,#1900
+STORE,R6,R0,#1904
+LOAD,R10,R0,#1904
+STORE,R7,R0,#1908
+LOAD,R11,R0,#1908
+STORE,R8,R0,#1912
+LOAD,R12,R0,#1912
+STORE,R9,R0,#1916
+LOAD,R13,R0,#1916
+STORE,R2,R0,#1920
+LOAD,R10,R0,#1920
+STORE,R3,R0,#1924
+LOAD,R11,R0,#1924
+STORE,R4,R0,#1928
+LOAD,R12,R0,#1928
+STORE,R5,R0,#1932
+LOAD,R13,R0,#1932
+STORE,R6,R0,#1936
+LOAD,R10,R0,#1936
+STORE,R7,R0,#1940
+LOAD,R11,R0,#1940
+STORE,R8,R0,#1944
+LOAD,R12,R0,#1944
+STORE,R9,R0,#1948
+LOAD,R13,R0,#1948
+STORE,R2,R0,#1952
+LOAD,R10,R0,#1952
+STORE,R3,R0,#1956
+LOAD,R11,R0,#1956
+STORE,R4,R0,#1960
+LOAD,R12,R0,#1960
+STORE,R5,R0,#1964
+LOAD,R13,R0,#1964
+STORE,R6,R0,#1968
+LOAD,R10,R0,#1968
+STORE,R7,R0,#1972
+LOAD,R11,R0,#1972
+STORE,R8,R0,#1976
+LOAD,R12,R0,#1976
+STORE,R9,R0,#1980
+LOAD,R13,R0,#1980
+STORE,R2,R0,#1984
+LOAD,R10,R0,#1984
+STORE,R3,R0,#1988
+LOAD,R11,R0,#1988
+STORE,R4,R0,#1992
+LOAD,R12,R0,#1992
+STORE,R5,R0,#1996
+LOAD,R13,R0,#1996
+STORE,R6,R0,#2000
+LOAD,R10,R0,#2000
+STORE,R7,R0,#2004
+LOAD,R11,R0,#2004
+STORE,R8,R0,#2008
+LOAD,R12,R0,#2008
+STORE,R9,R0,#2012
+LOAD,R13,R0,#2012
+STORE,R2,R0,#2016
+LOAD,R10,R0,#2016
+STORE,R3,R0,#2020
+LOAD,R11,R0,#2020
+STORE,R4,R0,#2024
+LOAD,R12,R0,#2024
+STORE,R5,R0,#2028
+LOAD,R13,R0,#2028
+STORE,R6,R0,#2032
+LOAD,R10,R0,#2032
+STORE,R7,R0,#2036
+LOAD,R11,R0,#2036
+STORE,R8,R0,#2040
+LOAD,R12,R0,#2040
+STORE,R9,R0,#2044
+LOAD,R13,R0,#2044
+STORE,R2,R0,#2048
+LOAD,R10,R0,#2048
+SUBL,R15,R15,#1
+BNZ,#-4100
+HALT
@@ -0,0 +1,107 @@
+#!/bin/sh
+#
+# run_bench.sh - run the bench/*.asm kernels and compare against bench/baseline.txt
+#
+# Usage: bench/run_bench.sh <apex_sim> [--update]
+#
+# Each kernel runs BENCH_RUNS times for at most BENCH_CYCLES cycles; the run
+# with the median host speed is kept. Simulated IPC is deterministic, so any difference from the
+# baseline is reported as a behaviour change. Host speed (simulated cycles per
+# second) and peak RSS are flagged when they get worse than BENCH_TOLERANCE
+# percent. --update rewrites the baseline with the current numbers.
+#
+# A kernel must also retire every instruction the functional engine executes
+# for it, so a run that hangs or retires a wrong path fails rather than being
+# recorded. A kernel runs with the simulator options in <kernel>.flags beside
+# it, if there is one. Every kernel loops for about a million simulated
+# cycles, so a run takes long enough for its host speed to be measured rather
+# than timer noise. The kernels named after what they stress repeat a
+# straight-line body whose branches skip forward over one instruction; R15
+# counts the passes. The feature kernels (load_reuse, stride_stream) loop to
+# train what their flags turn on.
+
+SIM=${1:?usage: $0 <apex_sim> [--update]}
+MODE=$2
+DIR=$(dirname "$0")
+BASELINE=$DIR/baseline.txt
+CYCLES=${BENCH_CYCLES:-5000000}
+RUNS=${BENCH_RUNS:-5}
+TOLERANCE=${BENCH_TOLERANCE:-25}
+RESULTS=$(mktemp) || exit 1
+RUNS_FILE=$(mktemp) || exit 1
+trap 'rm -f "$RESULTS" "$RUNS_FILE"' EXIT
+
+# Round robin over the kernels, so a slow spell of the host lands on every
+# kernel's runs rather than on all the runs of one
+run=0
+while [ $run -lt "$RUNS" ]; do
+  for kernel in "$DIR"/*.asm; do
+    name=$(basename "$kernel" .asm)
+    flags=
+    if [ -f "$DIR/$name.flags" ]; then
+      flags=$(cat "$DIR/$name.flags")
+    fi
+    "$SIM" "$kernel" run "$CYCLES" $flags --host-stats 2>&1 >/dev/null | grep '^APEX_Host' |
+      sed 's/[a-z_]*=//g' | awk -v name="$name" '{ print name, $3, $4, $7, $6, $8 }' >> "$RUNS_FILE"
+  done
+  run=$((run + 1))
+done
+
+for kernel in "$DIR"/*.asm; do
+  name=$(basename "$kernel" .asm)
+  grep "^$name " "$RUNS_FILE" | sort -k5,5nr | head -n $(((RUNS + 1) / 2)) | tail -n 1 |
+    tr '\n' ' ' >> "$RESULTS"
+  if ! grep -q "^$name " "$RESULTS"; then
+    echo "APEX_Error : $name produced no host statistics" >&2
+    exit 1
+  fi
+  "$SIM" "$kernel" run "$CYCLES" --checkpoints="$CYCLES" 2>/dev/null |
+    sed -n 's/.* \([0-9]*\) instructions executed functionally.*/\1/p' >> "$RESULTS"
+done
+
+if awk '$3 != $7 { printf "APEX_Error : %s retired %d instructions, the functional engine executes %d\n", $1, $3, $7; bad = 1 }
+        END { exit !bad }' "$RESULTS" >&2; then
+  exit 1
+fi
+
+if [ "$MODE" = "--update" ]; then
+  {
+    echo "# kernel cycles retired ipc cycles_per_sec max_rss_kb ($CYCLES cycle budget)"
+    cut -d' ' -f1-6 "$RESULTS"
+  } > "$BASELINE"
+  echo "Baseline written to $BASELINE"
+  exit 0
+fi
+
+awk -v tolerance="$TOLERANCE" '
+  FNR == NR {
+    if ($1 !~ /^#/) { ipc[$1] = $4; speed[$1] = $5; rss[$1] = $6 }
+    next
+  }
+  FNR == 1 {
+    printf "%-22s %8s %8s %8s %12s %12s %7s %9s  %s\n", "kernel", "cycles", "retired",
+           "ipc", "cycles/sec", "baseline", "speed", "rss_kb", "status"
+  }
+  {
+    status = "ok"
+    ratio = 0
+    if (!($1 in ipc)) {
+      status = "NEW"
+    } else {
+      ratio = speed[$1] > 0 ? $5 / speed[$1] : 0
+      if ($4 != ipc[$1]) {
+        status = "IPC CHANGED (was " ipc[$1] ")"
+        failed = 1
+      } else if (ratio < 1 - tolerance / 100) {
+        status = "SLOWER"
+        failed = 1
+      } else if ($6 > rss[$1] * (1 + tolerance / 100)) {
+        status = "RSS GREW (was " rss[$1] ")"
+        failed = 1
+      }
+    }
+    printf "%-22s %8d %8d %8.4f %12.0f %12.0f %6.2fx %9d  %s\n", $1, $2, $3, $4, $5,
+           speed[$1], ratio, $6, status
+  }
+  END { exit failed }
+' "$BASELINE" "$RESULTS"
@@ -0,0 +1,9 @@
+MOVC,R1,#110000
+MOVC,R2,#0
+MOVC,R5,#0
+LOAD,R4,R2,#0
+ADD,R5,R5,R4
+ADDL,R2,R2,#16
+SUBL,R1,R1,#1
+BNZ,#-16
+HALT
@@ -0,0 +1,195 @@
+/*
+ *  coherence.c
+ *  MESI state machine of the private L1 caches
+ */
+#include <string.h>
+
+#include "coherence.h"
+
+int
+coherence_init(COHERENCE_BUS* bus, APEX_MEMORY* memory, L1_CACHE* caches, int num_caches)
+{
+	if (pthread_mutex_init(&bus->lock, NULL) != 0) {
+		return 1;
+	}
+	bus->memory = memory;
+	bus->caches = caches;
+	bus->num_caches = num_caches;
+	for (int i = 0; i < num_caches; i++) {
+		memset(&caches[i], 0, sizeof(L1_CACHE));
+		caches[i].core_id = i;
+		caches[i].bus = bus;
+	}
+	return 0;
+}
+
+void
+coherence_destroy(COHERENCE_BUS* bus)
+{
+	pthread_mutex_destroy(&bus->lock);
+}
+
+/*
+ * Broadcasts a request for line_address to every other cache. Holders
+ * downgrade to Shared on a read and invalidate on a read exclusive or
+ * upgrade; a Modified holder writes back first. Returns how many other
+ * caches had a valid copy.
+ */
+static int
+snoop(L1_CACHE* requester, uint32_t line_address, int exclusive)
+{
+	COHERENCE_BUS* bus = requester->bus;
+	int holders = 0;
+	for (int i = 0; i < bus->num_caches; i++) {
+		L1_CACHE* other = &bus->caches[i];
+		if (other == requester) {
+			continue;
+		}
+		L1_LINE* line = &other->lines[line_address % L1_SETS];
+		if (line->state == MESI_INVALID || line->line_address != line_address) {
+			continue;
+		}
+		holders += 1;
+		if (line->state == MESI_MODIFIED) {
+			other->stats.writebacks += 1;
+		}
+		if (exclusive) {
+			line->state = MESI_INVALID;
+			other->stats.invalidations_received += 1;
+			requester->stats.invalidations_sent += 1;
+		} else {
+			line->state = MESI_SHARED;
+		}
+	}
+	return holders;
+}
+
+/*
+ * Runs the coherence transaction for one load or store at clock and
+ * returns the extra cycles it costs over an L1 hit. A hit on a line a
+ * prefetch is still filling waits for the fill to land.
+ */
+int
+l1_access(L1_CACHE* cache, uint32_t address, int is_store, int clock)
+{
+	uint32_t line_address = address >> L1_LINE_BITS;
+	L1_LINE* line = &cache->lines[line_address % L1_SETS];
+	int penalty = 0;
+
+	pthread_mutex_lock(&cache->bus->lock);
+	if (line->state != MESI_INVALID && line->line_address == line_address) {
+		cache->stats.hits += 1;
+		if (line->prefetched) {
+			line->prefetched = 0;
+			cache->stats.useful_prefetches += 1;
+			if (line->ready_clock > clock) {
+				cache->stats.late_prefetches += 1;
+				penalty = line->ready_clock - clock;
+			}
+		}
+		if (is_store && line->state == MESI_SHARED) {
+			cache->stats.bus_upgrades += 1;
+			snoop(cache, line_address, 1);
+			penalty += L1_TRANSFER_PENALTY;
+		}
+		if (is_store) {
+			line->state = MESI_MODIFIED;
+		}
+	} else {
+		cache->stats.misses += 1;
+		if (line->state == MESI_MODIFIED) {
+			cache->stats.writebacks += 1;
+		}
+		int holders;
+		if (is_store) {
+			cache->stats.bus_read_exclusives += 1;
+			holders = snoop(cache, line_address, 1);
+			line->state = MESI_MODIFIED;
+		} else {
+			cache->stats.bus_reads += 1;
+			holders = snoop(cache, line_address, 0);
+			line->state = holders ? MESI_SHARED : MESI_EXCLUSIVE;
+		}
+		line->line_address = line_address;
+		line->prefetched = 0;
+		if (holders) {
+			cache->stats.cache_to_cache += 1;
+			penalty = L1_TRANSFER_PENALTY;
+		} else {
+			penalty = L1_MISS_PENALTY;
+		}
+	}
+	pthread_mutex_unlock(&cache->bus->lock);
+	return penalty;
+}
+
+/*
+ * Starts a read fill of the line holding address at clock unless the
+ * cache already has it, evicting whatever the set held. The line is
+ * usable once the fill lands, after the same miss or transfer penalty a
+ * demand read pays. Returns 1 if a fill was started.
+ */
+int
+l1_prefetch(L1_CACHE* cache, uint32_t address, int clock)
+{
+	uint32_t line_address = address >> L1_LINE_BITS;
+	L1_LINE* line = &cache->lines[line_address % L1_SETS];
+
+	pthread_mutex_lock(&cache->bus->lock);
+	if (line->state != MESI_INVALID && line->line_address == line_address) {
+		pthread_mutex_unlock(&cache->bus->lock);
+		return 0;
+	}
+	if (line->state == MESI_MODIFIED) {
+		cache->stats.writebacks += 1;
+	}
+	cache->stats.prefetches += 1;
+	cache->stats.bus_reads += 1;
+	int holders = snoop(cache, line_address, 0);
+	line->state = holders ? MESI_SHARED : MESI_EXCLUSIVE;
+	line->line_address = line_address;
+	line->prefetched = 1;
+	if (holders) {
+		cache->stats.cache_to_cache += 1;
+		line->ready_clock = clock + L1_TRANSFER_PENALTY;
+	} else {
+		line->ready_clock = clock + L1_MISS_PENALTY;
+	}
+	pthread_mutex_unlock(&cache->bus->lock);
+	return 1;
+}
+
+int
+l1_read_word(L1_CACHE* cache, uint32_t address)
+{
+	pthread_mutex_lock(&cache->bus->lock);
+	int value = mem_read(cache->bus->memory, address);
+	pthread_mutex_unlock(&cache->bus->lock);
+	return value;
+}
+
+void
+l1_write_word(L1_CACHE* cache, uint32_t address, int value)
+{
+	pthread_mutex_lock(&cache->bus->lock);
+	mem_write(cache->bus->memory, address, value);
+	pthread_mutex_unlock(&cache->bus->lock);
+}
+
+/* Reads count consecutive words under one bus transaction, for VLOAD */
+void
+l1_read_words(L1_CACHE* cache, uint32_t address, int* words, int count)
+{
+	pthread_mutex_lock(&cache->bus->lock);
+	mem_read_words(cache->bus->memory, address, words, count);
+	pthread_mutex_unlock(&cache->bus->lock);
+}
+
+/* Writes count consecutive words under one bus transaction, for VSTORE */
+void
+l1_write_words(L1_CACHE* cache, uint32_t address, const int* words, int count)
+{
+	pthread_mutex_lock(&cache->bus->lock);
+	mem_write_words(cache->bus->memory, address, words, count);
+	pthread_mutex_unlock(&cache->bus->lock);
+}
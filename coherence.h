@@ -0,0 +1,98 @@
+#ifndef _APEX_COHERENCE_H_
+#define _APEX_COHERENCE_H_
+/**
+ *  coherence.h
+ *  Private L1 data caches kept coherent with MESI over a snooping bus
+ *
+ *  Caches only track tags and MESI state; data always lives in the
+ *  shared APEX_MEMORY behind the bus, so values are coherent by
+ *  construction and the model only decides latency and bus traffic.
+ *  Every access holds the bus lock, which serializes transactions
+ *  between cores running on different host threads.
+ */
+#include <pthread.h>
+#include <stdint.h>
+
+#include "memory.h"
+
+#define L1_SETS 64		// Direct mapped
+#define L1_LINE_BITS 2		// 4 words per line
+#define L1_MISS_PENALTY 8	// Extra cycles to fill a line from memory
+#define L1_TRANSFER_PENALTY 4	// Extra cycles for a cache to cache transfer or an upgrade
+
+enum MESI_STATE
+{
+	MESI_INVALID,
+	MESI_SHARED,
+	MESI_EXCLUSIVE,
+	MESI_MODIFIED
+};
+
+typedef struct L1_LINE
+{
+	uint32_t line_address;	// address >> L1_LINE_BITS
+	int state;		// enum MESI_STATE
+	int ready_clock;	// Clock a prefetch fill of the line lands
+	int prefetched;		// Filled by a prefetch and not accessed yet
+} L1_LINE;
+
+/* Traffic seen by one cache, both requests it made and snoops it answered */
+typedef struct COHERENCE_STATS
+{
+	int hits;
+	int misses;
+	int bus_reads;		// BusRd, read miss
+	int bus_read_exclusives;	// BusRdX, write miss
+	int bus_upgrades;	// BusUpgr, write hit on a Shared line
+	int invalidations_sent;	// Remote copies this cache's writes invalidated
+	int invalidations_received;
+	int writebacks;		// Modified lines written back on eviction or snoop
+	int cache_to_cache;	// Misses served by another cache
+	int prefetches;		// Lines filled by the prefetcher
+	int useful_prefetches;	// Prefetched lines a load or store hit, in time or not
+	int late_prefetches;	// Hits that waited for a prefetch still filling
+} COHERENCE_STATS;
+
+struct L1_CACHE;
+
+typedef struct COHERENCE_BUS
+{
+	pthread_mutex_t lock;
+	APEX_MEMORY* memory;
+	struct L1_CACHE* caches;
+	int num_caches;
+} COHERENCE_BUS;
+
+typedef struct L1_CACHE
+{
+	int core_id;
+	COHERENCE_BUS* bus;
+	L1_LINE lines[L1_SETS];
+	COHERENCE_STATS stats;
+} L1_CACHE;
+
+int
+coherence_init(COHERENCE_BUS* bus, APEX_MEMORY* memory, L1_CACHE* caches, int num_caches);
+
+void
+coherence_destroy(COHERENCE_BUS* bus);
+
+int
+l1_access(L1_CACHE* cache, uint32_t address, int is_store, int clock);
+
+int
+l1_prefetch(L1_CACHE* cache, uint32_t address, int clock);
+
+int
+l1_read_word(L1_CACHE* cache, uint32_t address);
+
+void
+l1_write_word(L1_CACHE* cache, uint32_t address, int value);
+
+void
+l1_read_words(L1_CACHE* cache, uint32_t address, int* words, int count);
+
+void
+l1_write_words(L1_CACHE* cache, uint32_t address, const int* words, int count);
+
+#endif
@@ -11,15 +11,8 @@
 #include <string.h>
 
 #include "cpu.h"
-
-/* Set this flag to 1 to enable debug messages */
-int ENABLE_DEBUG_MESSAGES = 1;
-
-BTB_ENTRY* mispredicted_branch_btb_entry;
-IQ_ENTRY* mispredicted_branch_iq_entry;
-int mispredicted_branch_target_address_new;
-int flush_and_reload = 0;
-int stop_fetch_decode = 0;
+#include "functional.h"
+#include "log.h"
 
 const int LSQ_SIZE = 6;
 const int BTB_SIZE = 8;
@@ -28,6 +21,255 @@ const int ROB_SIZE = 12;
 const int IQ_SIZE = 8;
 const int PRF_SIZE = 24;
 const int ARF_SIZE = 16;
+/* Every IQ entry's bit set in the iq_* masks */
+#define IQ_FULL_MASK ((1u << IQ_SIZE) - 1)
+
+/* Marks latch as written this cycle and returns the buffer to fill */
+static CPU_Stage*
+latch_fill(CPU_LATCH* latch)
+{
+	latch->written = 1;
+	return latch->next;
+}
+
+/*
+ * Hands the instruction in from's current buffer on to the next stage
+ * without copying it. The buffer becomes to's next one, and from takes
+ * to's old next buffer in exchange, whose instruction every stage is
+ * done with, so from skips it until it is filled again.
+ */
+static void
+latch_pass(CPU_LATCH* from, CPU_LATCH* to)
+{
+	CPU_Stage* passed = from->cur;
+	from->cur = to->next;
+	to->next = passed;
+	to->written = 1;
+}
+
+/*
+ * Clock edge: latches written this cycle make their next buffer current,
+ * but one whose stage stalled keeps cur and becomes held
+ */
+static void
+latch_clock(CPU_LATCH* latches, int count)
+{
+	for (int i = 0; i < count; i++) {
+		latches[i].held = latches[i].cur->stalled;
+		if (latches[i].written && !latches[i].held) {
+			CPU_Stage* latched = latches[i].next;
+			latches[i].next = latches[i].cur;
+			latches[i].cur = latched;
+			latches[i].written = 0;
+		}
+	}
+}
+
+/* Recounts rename_refs after whole rename tables were replaced */
+static void
+count_rename_refs(APEX_CPU* cpu)
+{
+	memset(cpu->rename_refs, 0, sizeof(cpu->rename_refs));
+	for (int t = 0; t < cpu->num_threads; t++) {
+		for (int r = 0; r < ARF_SIZE; r++) {
+			if (cpu->threads[t].rename_table[r] > -1) {
+				cpu->rename_refs[cpu->threads[t].rename_table[r]] += 1;
+			}
+		}
+	}
+}
+
+/*
+ * Frees phys_reg once nothing holds it: no rename table maps it, no
+ * instruction still reads it or is still to write it, and no recovery
+ * can map it again. Every place one of those counts drops calls this.
+ */
+static void
+release_register(APEX_CPU* cpu, int phys_reg)
+{
+	if(phys_reg < 0 || phys_reg >= cpu->prf_size) {
+		return;
+	}
+	if(cpu->rename_refs[phys_reg] == 0 && cpu->consumers[phys_reg] <= 0 && cpu->writers[phys_reg] == 0
+	   && cpu->checkpoint_refs[phys_reg] == 0 && !(cpu->value_prediction_enabled && cpu->retired_refs[phys_reg] > 0)) {
+		cpu->free_PR_list[phys_reg] = 1;
+	}
+}
+
+/* Takes back one read of phys_reg decode counted */
+static void
+drop_consumer(APEX_CPU* cpu, int phys_reg)
+{
+	cpu->consumers[phys_reg] -= 1;
+	release_register(cpu, phys_reg);
+}
+
+/* Points *slot, one of the references refs counts, at phys_reg instead of what it held */
+static void
+move_register_ref(APEX_CPU* cpu, int* refs, int* slot, int phys_reg)
+{
+	int previous = *slot;
+	*slot = phys_reg;
+	if(phys_reg > -1) {
+		refs[phys_reg] += 1;
+	}
+	if(previous > -1) {
+		refs[previous] -= 1;
+		release_register(cpu, previous);
+	}
+}
+
+/* Copies the registers ROB[index] of thread writes into its rob_tags, once decode has filled it in */
+static void
+set_rob_tags(APEX_THREAD* thread, int index)
+{
+	ROB_ENTRY* rob_entry = &thread->ROB[index];
+	int8_t* tags = thread->rob_tags[index];
+	int count = 0;
+	if(rob_entry->phys_register > -1) {
+		tags[count++] = rob_entry->phys_register;
+	}
+	if(rob_entry->fused == FUSED_MOVC && rob_entry->fused_phys_register > -1) {
+		tags[count++] = rob_entry->fused_phys_register;
+	}
+	for(int lane = 0; lane < rob_entry->lanes; lane++) {
+		if(rob_entry->lane_phys_registers[lane] > -1) {
+			tags[count++] = rob_entry->lane_phys_registers[lane];
+		}
+	}
+	thread->rob_tag_count[index] = count;
+}
+
+/*
+ * Adds delta to the writers of every register in the rob_tags of
+ * ROB[index] of thread, as it is dispatched (1) or commits or is
+ * squashed (-1).
+ */
+static void
+count_writers(APEX_CPU* cpu, APEX_THREAD* thread, int index, int delta)
+{
+	const int8_t* tags = thread->rob_tags[index];
+	for(int i = 0; i < thread->rob_tag_count[index]; i++) {
+		cpu->writers[tags[i]] += delta;
+		if(delta < 0) {
+			release_register(cpu, tags[i]);
+		}
+	}
+}
+
+/* Reports the squash of ROB[index] of thread, and of the instruction fused into it, to the pipeline trace */
+static void
+trace_rob_squash(APEX_CPU* cpu, APEX_THREAD* thread, int index)
+{
+	if(!cpu->trace) {
+		return;
+	}
+	ROB_ENTRY* squashed = &thread->ROB[index];
+	trace_event(cpu->trace, TRACE_SQUASH, thread->rob_seq[index], squashed->pc_value, cpu->clock);
+	if(squashed->fused) {
+		trace_event(cpu->trace, TRACE_SQUASH, squashed->fused_seq, squashed->fused_pc, cpu->clock);
+	}
+}
+
+/*
+ * Adds delta to the checkpoint_refs of the registers the checkpoint of
+ * bis_entry maps, as the BIS entry is pushed (1) or popped (-1).
+ */
+static void
+count_checkpoint(APEX_CPU* cpu, APEX_THREAD* thread, BIS_ENTRY* bis_entry, int delta)
+{
+	int* table = bis_entry->checkpoint_entry == 1 ? thread->checkpoint_rename_table_1 : thread->checkpoint_rename_table_2;
+	cpu->checkpoint_refs[bis_entry->latest_arithmetic_phys_reg] += delta;
+	for(int r = 0; r < ARF_SIZE; r++) {
+		if(table[r] > -1) {
+			cpu->checkpoint_refs[table[r]] += delta;
+		}
+	}
+	if(delta < 0) {
+		release_register(cpu, bis_entry->latest_arithmetic_phys_reg);
+		for(int r = 0; r < ARF_SIZE; r++) {
+			release_register(cpu, table[r]);
+		}
+	}
+}
+
+/* Recounts checkpoint_refs and retired_refs after recovery replaced the state they count */
+static void
+count_checkpoint_refs(APEX_CPU* cpu)
+{
+	memset(cpu->checkpoint_refs, 0, sizeof(cpu->checkpoint_refs));
+	memset(cpu->retired_refs, 0, sizeof(cpu->retired_refs));
+	for(int t = 0; t < cpu->num_threads; t++) {
+		APEX_THREAD* thread = &cpu->threads[t];
+		cpu->checkpoint_refs[thread->latest_arithmetic_inst_phys_reg] += 1;
+		cpu->retired_refs[thread->retired_arithmetic_phys_reg] += 1;
+		for(int r = 0; r < ARF_SIZE; r++) {
+			if(thread->retired_rename_table[r] > -1) {
+				cpu->retired_refs[thread->retired_rename_table[r]] += 1;
+			}
+		}
+		for(int i = 0, index = thread->bis_head; i < thread->bis_current_size; i++, index = (index + 1) % BIS_SIZE) {
+			count_checkpoint(cpu, thread, &thread->BIS[index], 1);
+		}
+	}
+}
+
+/*
+ * Resets hardware thread context index and hands it code_memory. Returns 1,
+ * freeing code_memory, if the profile counters cannot be allocated.
+ */
+static int
+init_thread_state(APEX_CPU *cpu, int index, APEX_Instruction *code_memory, int code_memory_size)
+{
+	APEX_THREAD *thread = &cpu->threads[index];
+	memset(thread, 0, sizeof(*thread));
+	thread->pc = 4000;
+	memset(thread->regs, -1, sizeof(int) * 16);
+	memset(thread->regs_valid, 1, sizeof(int) * 16);
+	memset(thread->free_PR_list_checkpoint_1, 1, sizeof(thread->free_PR_list_checkpoint_1));
+	memset(thread->free_PR_list_checkpoint_2, 1, sizeof(thread->free_PR_list_checkpoint_2));
+	memset(thread->rename_table, -1, sizeof(int) * 16);
+	memset(thread->retired_rename_table, -1, sizeof(thread->retired_rename_table));
+	memset(thread->checkpoint_rename_table_1, -1, sizeof(int) * 16);
+	thread->rob_tail = thread->bis_tail = thread->rob_head = thread->bis_head = -1;
+	/* A BZ/BNZ before any arithmetic instruction sees the zero flag set */
+	thread->latest_arithmetic_inst_phys_reg = thread->retired_arithmetic_phys_reg = APEX_ZERO_REG;
+	cpu->checkpoint_refs[APEX_ZERO_REG] += 1;
+	cpu->retired_refs[APEX_ZERO_REG] += 1;
+	/* Decode starts busy, fetch clears it with the first instruction */
+	thread->latch[DRF].cur = &thread->latch_buffers[0];
+	thread->latch[DRF].next = &thread->latch_buffers[1];
+	thread->latch[DRF].cur->busy = 1;
+	thread->latch[F].cur = thread->latch[F].next = &thread->latch_buffers[2];
+
+	/* Take over the already parsed code memory */
+	thread->code_memory = code_memory;
+	thread->code_memory_size = code_memory_size;
+	thread->pc_profile = calloc(thread->code_memory_size, sizeof(PC_PROFILE));
+	if (!thread->pc_profile) {
+		free(thread->code_memory);
+		thread->code_memory = NULL;
+		return 1;
+	}
+
+	if (LOG_ENABLED(LOG_CPU, LOG_DEBUG)) {
+		log_printf(
+				"APEX_CPU : Initialized APEX CPU thread %d, loaded %d instructions\n",
+				index, thread->code_memory_size);
+		log_printf( "APEX_CPU : Printing Code Memory\n");
+		log_printf("%-9s %-9s %-9s %-9s %-9s\n", "opcode", "rd", "rs1", "rs2", "imm");
+
+		for (int i = 0; i < thread->code_memory_size; ++i) {
+			log_printf("%-9s %-9d %-9d %-9d %-9d\n",
+				   thread->code_memory[i].opcode,
+				   thread->code_memory[i].rd,
+				   thread->code_memory[i].rs1,
+				   thread->code_memory[i].rs2,
+				   thread->code_memory[i].imm);
+		}
+	}
+	return 0;
+}
 
 /*
  * This function creates and initializes APEX cpu.
@@ -35,76 +277,194 @@ const int ARF_SIZE = 16;
  * Note : You are free to edit this function according to your
  * 				implementation
  */
-APEX_CPU *
-APEX_cpu_init(const char *filename)
+static APEX_CPU *
+init_cpu_state(APEX_Instruction *code_memory, int code_memory_size)
 {
-	if (!filename) {
-		return NULL;
-	}
-
-	APEX_CPU *cpu = malloc(sizeof(*cpu));
+	APEX_CPU *cpu = calloc(1, sizeof(*cpu));
 	if (!cpu) {
+		free(code_memory);
 		return NULL;
 	}
 
 	/* Initialize PC, Registers and all pipeline stages */
-	cpu->pc = 4000;
-	memset(cpu->regs, -1, sizeof(int) * 16);
-	memset(cpu->regs_valid, 1, sizeof(int) * 16);
-	memset(cpu->phys_regs, 0, sizeof(int) * 24);
-	memset(cpu->phys_regs_valid, 1, sizeof(int) * 24);
-	memset(cpu->free_PR_list, 1, sizeof(int) * 24);
-	memset(cpu->free_PR_list_checkpoint_1, 1, sizeof(int) * 24);
-	memset(cpu->free_PR_list_checkpoint_2, 1, sizeof(int) * 24);
-	memset(cpu->flag_condition, -1, sizeof(int) * 24);
-	memset(cpu->rename_table, -1, sizeof(int) * 16);
-	memset(cpu->checkpoint_rename_table_1, -1, sizeof(int) * 16);
-	memset(cpu->checkpoint_rename_table_1, -1, sizeof(int) * 16);
-	memset(cpu->stage, 0, sizeof(CPU_Stage) * NUM_STAGES);
-	memset(cpu->data_memory, 0, sizeof(int) * 4000);
-	memset(cpu->consumers, 0, sizeof(int) * 24);
-	//memset(cpu->iq_free, 1, sizeof(int) * IQ_SIZE);
-	memset(cpu->ROB, 0, sizeof(ROB_ENTRY) * ROB_SIZE);
+	memset(cpu->phys_regs, 0, sizeof(cpu->phys_regs));
+	memset(cpu->phys_regs_valid, 1, sizeof(cpu->phys_regs_valid));
+	memset(cpu->free_PR_list, 1, sizeof(cpu->free_PR_list));
+	memset(cpu->flag_condition, -1, sizeof(cpu->flag_condition));
+	memset(cpu->latch_buffers, 0, sizeof(cpu->latch_buffers));
+	memset(cpu->consumers, 0, sizeof(cpu->consumers));
+	cpu->phys_regs_valid[APEX_ZERO_REG] = 1;
+	cpu->free_PR_list[APEX_ZERO_REG] = 0;
+	cpu->flag_condition[APEX_ZERO_REG] = 1;
 	memset(cpu->IQ, 0, sizeof(IQ_ENTRY) * IQ_SIZE);
 	memset(cpu->LSQ, 0, sizeof(LSQ_ENTRY) * LSQ_SIZE);
-	memset(cpu->BTB, 0, sizeof(BTB_ENTRY) * BTB_SIZE);
-	memset(cpu->BIS, 0, sizeof(BIS_ENTRY) * BIS_SIZE);
-	cpu->rob_tail = cpu->lsq_tail = cpu->bis_tail = cpu->rob_head = cpu->lsq_head = cpu->bis_head = -1;
-	cpu->rob_current_size = cpu->lsq_current_size = cpu->bis_current_size = cpu->btb_tail = 0;
-	cpu->checkpoint1_free = cpu->checkpoint2_free = 1;
-	memset(cpu->iq_free, 1, sizeof(int) * IQ_SIZE);
+	cpu->lsq_tail = cpu->lsq_head = -1;
+	cpu->lsq_current_size = 0;
+	cpu->iq_valid = 0;
+	cpu->spec_load_reg = -1;
+	cpu->num_threads = 1;
+	cpu->rob_partition = ROB_SIZE;
+	cpu->prf_size = PRF_SIZE;
+	machine_init(&cpu->machine);
+
+	if (init_thread_state(cpu, 0, code_memory, code_memory_size)) {
+		free(cpu);
+		return NULL;
+	}
+
+	/* Make all stages busy except Fetch stage, initally to start the pipeline*/
+	for (int i = 0; i < NUM_STAGES; ++i) {
+		cpu->latch[i].cur = &cpu->latch_buffers[0][i];
+		cpu->latch[i].next = &cpu->latch_buffers[1][i];
+		cpu->latch[i].cur->busy = cpu->latch[i].next->busy = i > 0;
+	}
+
+	return cpu;
+}
+
+APEX_CPU *
+APEX_cpu_init(const char *filename)
+{
+	if (!filename) {
+		return NULL;
+	}
 
 	/* Parse input file and create code memory */
-	cpu->code_memory = create_code_memory(filename, &cpu->code_memory_size);
+	int code_memory_size;
+	APEX_Instruction *code_memory = create_code_memory(filename, &code_memory_size);
+	if (!code_memory) {
+		return NULL;
+	}
+	return init_cpu_state(code_memory, code_memory_size);
+}
 
-	if (!cpu->code_memory) {
-		free(cpu);
+/* Same as APEX_cpu_init, with the program text already in memory */
+APEX_CPU *
+APEX_cpu_init_buffer(const char *buffer, size_t length)
+{
+	if (!buffer || !length) {
+		return NULL;
+	}
+	FILE *fp = fmemopen((void *) buffer, length, "r");
+	if (!fp) {
+		return NULL;
+	}
+	int code_memory_size;
+	APEX_Instruction *code_memory = create_code_memory_from_stream(fp, &code_memory_size);
+	fclose(fp);
+	if (!code_memory) {
 		return NULL;
 	}
+	return init_cpu_state(code_memory, code_memory_size);
+}
 
-	if (ENABLE_DEBUG_MESSAGES) {
-		fprintf(stderr,
-				"APEX_CPU : Initialized APEX CPU, loaded %d instructions\n",
-				cpu->code_memory_size);
-		fprintf(stderr, "APEX_CPU : Printing Code Memory\n");
-		printf("%-9s %-9s %-9s %-9s %-9s\n", "opcode", "rd", "rs1", "rs2", "imm");
+/*
+ * Loads filename into the next free hardware thread context, turning the
+ * core into an SMT core. Must be called before the first cycle. The ROB
+ * is split evenly between the threads and the PRF grows by one ARF's
+ * worth of registers per added thread. Returns 1 on failure.
+ */
+int
+APEX_cpu_add_thread(APEX_CPU *cpu, const char *filename)
+{
+	if (cpu->clock > 0 || cpu->num_threads == APEX_MAX_THREADS) {
+		fprintf(stderr, "APEX_Error : At most %d threads, added before the first cycle\n", APEX_MAX_THREADS);
+		return 1;
+	}
+	int code_memory_size;
+	APEX_Instruction *code_memory = create_code_memory(filename, &code_memory_size);
+	if (!code_memory || init_thread_state(cpu, cpu->num_threads, code_memory, code_memory_size)) {
+		return 1;
+	}
+	cpu->num_threads += 1;
+	cpu->rob_partition = ROB_SIZE / cpu->num_threads;
+	cpu->prf_size = PRF_SIZE + ARF_SIZE * (cpu->num_threads - 1);
+	return 0;
+}
 
-		for (int i = 0; i < cpu->code_memory_size; ++i) {
-			printf("%-9s %-9d %-9d %-9d %-9d\n",
-				   cpu->code_memory[i].opcode,
-				   cpu->code_memory[i].rd,
-				   cpu->code_memory[i].rs1,
-				   cpu->code_memory[i].rs2,
-				   cpu->code_memory[i].imm);
-		}
+/*
+ * Puts an I-cache with config in front of fetch, switching to the
+ * decoupled front end: branch prediction runs ahead of fetch through
+ * the FTQ and the I-cache fills the fetch buffer while decode stalls.
+ * Must be called before the first cycle. Returns 1 on failure.
+ */
+int
+APEX_cpu_enable_icache(APEX_CPU *cpu, const ICACHE_CONFIG *config)
+{
+	if (cpu->clock > 0 || cpu->icache) {
+		fprintf(stderr, "APEX_Error : The I-cache must be enabled once, before the first cycle\n");
+		return 1;
+	}
+	ICACHE *icache = malloc(sizeof(*icache));
+	if (!icache || icache_init(icache, config)) {
+		free(icache);
+		return 1;
 	}
+	cpu->icache = icache;
+	return 0;
+}
 
-	/* Make all stages busy except Fetch stage, initally to start the pipeline*/
-	for (int i = 1; i < NUM_STAGES; ++i) {
-		cpu->stage[i].busy = 1;
+/*
+ * Trains a data prefetcher with config on the addresses the LSQ sends
+ * to the core's private L1 and fills the lines it predicts into it.
+ * Needs the L1 of a multi-core system and must be called before the
+ * first cycle. Returns 1 on failure.
+ */
+int
+APEX_cpu_enable_prefetcher(APEX_CPU *cpu, const PREFETCH_CONFIG *config)
+{
+	if (cpu->clock > 0 || cpu->prefetcher || !cpu->l1) {
+		fprintf(stderr, "APEX_Error : The prefetcher needs an L1 and must be enabled once, before the first cycle\n");
+		return 1;
 	}
+	PREFETCHER *prefetcher = malloc(sizeof(*prefetcher));
+	if (!prefetcher || prefetcher_init(prefetcher, config, cpu->l1)) {
+		free(prefetcher);
+		return 1;
+	}
+	cpu->prefetcher = prefetcher;
+	return 0;
+}
 
-	return cpu;
+/*
+ * Starts a fresh single thread CPU from a functional checkpoint: arch
+ * register r is mapped to physical register r with its value, or shares
+ * APEX_ZERO_REG if it holds 0 so registers a program has not written pin
+ * nothing, the zero flag the next BZ/BNZ reads is set from the last
+ * arithmetic result and the checkpoint's stored pages are copied over
+ * data memory. Must be called before the first cycle. Returns 1 on
+ * failure.
+ */
+int
+APEX_cpu_restore(APEX_CPU *cpu, struct APEX_CHECKPOINT *checkpoint)
+{
+	if (cpu->clock > 0 || cpu->num_threads != 1) {
+		fprintf(stderr, "APEX_Error : Checkpoints restore into a single thread, before the first cycle\n");
+		return 1;
+	}
+	APEX_THREAD *thread = &cpu->threads[0];
+	thread->pc = checkpoint->pc;
+	for (int r = 0; r < ARF_SIZE; r++) {
+		thread->regs[r] = checkpoint->regs[r];
+		// The last arithmetic destination keeps a register of its own for the flag
+		int phys_reg = checkpoint->regs[r] == 0 && r != checkpoint->last_result_reg ? APEX_ZERO_REG : r;
+		thread->rename_table[r] = phys_reg;
+		thread->retired_rename_table[r] = phys_reg;
+		if (phys_reg == r) {
+			cpu->phys_regs[r] = checkpoint->regs[r];
+			cpu->phys_regs_valid[r] = 1;
+			cpu->free_PR_list[r] = 0;
+		}
+	}
+	count_rename_refs(cpu);
+	if (checkpoint->last_result_reg >= 0) {
+		thread->latest_arithmetic_inst_phys_reg = checkpoint->last_result_reg;
+		thread->retired_arithmetic_phys_reg = checkpoint->last_result_reg;
+		cpu->flag_condition[checkpoint->last_result_reg] = (checkpoint->last_result == 0);
+	}
+	count_checkpoint_refs(cpu);
+	mem_copy_dirty_pages(&cpu->data_memory, &checkpoint->memory);
+	return 0;
 }
 
 /*
@@ -115,7 +475,21 @@ APEX_cpu_init(const char *filename)
  */
 void APEX_cpu_stop(APEX_CPU *cpu)
 {
-	free(cpu->code_memory);
+	if (cpu->interval_fp) {
+		fclose(cpu->interval_fp);
+		free(cpu->interval_buffer);
+	}
+	trace_close(cpu->trace);
+	if (cpu->icache) {
+		icache_free(cpu->icache);
+		free(cpu->icache);
+	}
+	free(cpu->prefetcher);
+	mem_free(&cpu->data_memory);
+	for (int i = 0; i < cpu->num_threads; i++) {
+		free(cpu->threads[i].code_memory);
+		free(cpu->threads[i].pc_profile);
+	}
 	free(cpu);
 }
 
@@ -130,88 +504,97 @@ int get_code_index(int pc)
 	return (pc - 4000) / 4;
 }
 
+/* Profile slot for pc, or NULL when pc lies outside code memory */
+static PC_PROFILE*
+profile_of(APEX_THREAD* thread, int pc)
+{
+	unsigned int index = get_code_index(pc);
+	return index < (unsigned int) thread->code_memory_size ? &thread->pc_profile[index] : NULL;
+}
+
 static void
 print_instruction(CPU_Stage *stage, APEX_CPU* cpu, IQ_ENTRY* iq_entry, int from_stage)
 {
-	char opcode[128];
-	strcpy(opcode, (from_stage > DRF ? iq_entry->opcode : stage->opcode));
-	if (strcmp(opcode, "STORE") == 0) {
-		if(from_stage == F) {
-			printf("%s,R%d,R%d,#%d ", opcode, stage->rs1, stage->rs2, stage->imm);
+	APEX_THREAD* thread = &cpu->threads[iq_entry ? iq_entry->thread : cpu->front_end_thread];
+	int op = from_stage > DRF ? iq_entry->op : stage->op;
+	const char* opcode = opcode_names[op];
+	// Moves eliminated at rename reach decode's print without an IQ entry, like HALT
+	if (op == OP_STORE || op == OP_VSTORE) {
+		if(from_stage == F || !iq_entry) {
+			log_printf("%s,R%d,R%d,#%d ", opcode, stage->rs1, stage->rs2, stage->imm);
 		} else {
-			APEX_Instruction *current_ins = &cpu->code_memory[get_code_index(iq_entry->pc_value)];
-			printf("%s,R%d,R%d,#%d ", opcode, current_ins->rs1, current_ins->rs2, current_ins->imm);
+			APEX_Instruction *current_ins = &thread->code_memory[get_code_index(iq_entry->pc_value)];
+			log_printf("%s,R%d,R%d,#%d ", opcode, current_ins->rs1, current_ins->rs2, current_ins->imm);
 		}
 		if(iq_entry) {
 			LSQ_ENTRY* lsq_entry = &cpu->LSQ[iq_entry->lsq_index];
-			printf("[%s,P%d,P%d,#%d]", opcode, lsq_entry->src1_tag, iq_entry->src1_tag, iq_entry->literal);
+			log_printf("[%s,P%d,P%d,#%d]", opcode, lsq_entry->src1_tag, iq_entry->src1_tag, iq_entry->literal);
 		}	
-	} else if (strcmp(opcode, "MOVC") == 0) {
-		if(from_stage == F) {
-			printf("%s,R%d,#%d ", opcode, stage->rd, stage->imm);
+	} else if (op == OP_MOVC) {
+		if(from_stage == F || !iq_entry) {
+			log_printf("%s,R%d,#%d ", opcode, stage->rd, stage->imm);
 		} else {
-			APEX_Instruction *current_ins = &cpu->code_memory[get_code_index(iq_entry->pc_value)];
-			printf("%s,R%d,#%d ", opcode, current_ins->rd, current_ins->imm);
+			APEX_Instruction *current_ins = &thread->code_memory[get_code_index(iq_entry->pc_value)];
+			log_printf("%s,R%d,#%d ", opcode, current_ins->rd, current_ins->imm);
 		}
 		if(iq_entry) {
-			printf("[%s,P%d,#%d]", opcode, iq_entry->des_physical_reg, iq_entry->literal);
+			log_printf("[%s,P%d,#%d]", opcode, iq_entry->des_physical_reg, iq_entry->literal);
 		}
-	} else if (strcmp(opcode, "ADD") == 0 || strcmp(opcode, "SUB") == 0 || strcmp(opcode, "MUL") == 0 || strcmp(opcode, "LDR") == 0 || strcmp(opcode, "AND") == 0 || strcmp(opcode, "OR") == 0 || strcmp(opcode, "EX-OR") == 0) {
-		if(from_stage == F) {
-			printf("%s,R%d,R%d,R%d ", opcode, stage->rd, stage->rs1, stage->rs2);
+	} else if (op == OP_ADD || op == OP_SUB || op == OP_MUL || op == OP_LDR || op == OP_AND || op == OP_OR || op == OP_EXOR || vector_alu_op(op) >= 0) {
+		if(from_stage == F || !iq_entry) {
+			log_printf("%s,R%d,R%d,R%d ", opcode, stage->rd, stage->rs1, stage->rs2);
 		} else {
-			APEX_Instruction *current_ins = &cpu->code_memory[get_code_index(iq_entry->pc_value)];
-			printf("%s,R%d,R%d,R%d ", opcode, current_ins->rd, current_ins->rs1, current_ins->rs2);
+			APEX_Instruction *current_ins = &thread->code_memory[get_code_index(iq_entry->pc_value)];
+			log_printf("%s,R%d,R%d,R%d ", opcode, current_ins->rd, current_ins->rs1, current_ins->rs2);
 		}
 		if(iq_entry) {
-			printf("[%s,P%d,P%d,P%d]", opcode, iq_entry->des_physical_reg, iq_entry->src1_tag, iq_entry->src2_tag);
+			log_printf("[%s,P%d,P%d,P%d]", opcode, iq_entry->des_physical_reg, iq_entry->src1_tag, iq_entry->src2_tag);
 		}	
-	} else if (strcmp(opcode, "LOAD") == 0 || strcmp(opcode, "ADDL") == 0 || strcmp(opcode, "SUBL") == 0) {
-		if(from_stage == F) {
-			printf("%s,R%d,R%d,#%d ", opcode, stage->rd, stage->rs1, stage->imm);
+	} else if (op == OP_LOAD || op == OP_ADDL || op == OP_SUBL || op == OP_VLOAD) {
+		if(from_stage == F || !iq_entry) {
+			log_printf("%s,R%d,R%d,#%d ", opcode, stage->rd, stage->rs1, stage->imm);
 		} else {
-			APEX_Instruction *current_ins = &cpu->code_memory[get_code_index(iq_entry->pc_value)];
-			printf("%s,R%d,R%d,#%d ", opcode, current_ins->rd, current_ins->rs1, current_ins->imm);
+			APEX_Instruction *current_ins = &thread->code_memory[get_code_index(iq_entry->pc_value)];
+			log_printf("%s,R%d,R%d,#%d ", opcode, current_ins->rd, current_ins->rs1, current_ins->imm);
 		}
 		if(iq_entry) {
-			printf("[%s,P%d,P%d,#%d]", opcode, iq_entry->des_physical_reg, iq_entry->src1_tag, iq_entry->literal);
+			log_printf("[%s,P%d,P%d,#%d]", opcode, iq_entry->des_physical_reg, iq_entry->src1_tag, iq_entry->literal);
 		}	
-	} else if (strcmp(opcode, "STR") == 0) {	
-		if(from_stage == F) {
-			printf("%s,R%d,R%d,R%d ", opcode, stage->rs1, stage->rs2, stage->rs3);
+	} else if (op == OP_STR) {	
+		if(from_stage == F || !iq_entry) {
+			log_printf("%s,R%d,R%d,R%d ", opcode, stage->rs1, stage->rs2, stage->rs3);
 		} else {
-			APEX_Instruction *current_ins = &cpu->code_memory[get_code_index(iq_entry->pc_value)];
-			printf("%s,R%d,R%d,R%d ", opcode, current_ins->rs1, current_ins->rs2, current_ins->rs3);
+			APEX_Instruction *current_ins = &thread->code_memory[get_code_index(iq_entry->pc_value)];
+			log_printf("%s,R%d,R%d,R%d ", opcode, current_ins->rs1, current_ins->rs2, current_ins->rs3);
 		}
 		if(iq_entry) {
 			LSQ_ENTRY* lsq_entry = &cpu->LSQ[iq_entry->lsq_index];
-			printf("[%s,P%d,P%d,P%d]", opcode, lsq_entry->src1_tag, iq_entry->src1_tag, iq_entry->src2_tag);
+			log_printf("[%s,P%d,P%d,P%d]", opcode, lsq_entry->src1_tag, iq_entry->src1_tag, iq_entry->src2_tag);
 		}	
-	} else if (strcmp(opcode, "BZ") == 0 || strcmp(opcode, "BNZ") == 0) {
-		if(from_stage == F) {
-			printf("%s,#%d", opcode, stage->imm);
+	} else if (op == OP_BZ || op == OP_BNZ) {
+		if(from_stage == F || !iq_entry) {
+			log_printf("%s,#%d", opcode, stage->imm);
 		} else {
 		}
 		if(iq_entry) {
-			printf("[%s,#%d]", opcode, iq_entry->literal);
+			log_printf("[%s,#%d]", opcode, iq_entry->literal);
 		}
-	} else if (strcmp(opcode, "JUMP") == 0) {
-		if(from_stage == F) {
-			printf("%s,R%d,#%d ", opcode, stage->rs1, stage->imm);
+	} else if (op == OP_JUMP) {
+		if(from_stage == F || !iq_entry) {
+			log_printf("%s,R%d,#%d ", opcode, stage->rs1, stage->imm);
 		} else {
-			APEX_Instruction *current_ins = &cpu->code_memory[get_code_index(iq_entry->pc_value)];
-			printf("%s,R%d,#%d ", opcode, current_ins->rs1, iq_entry->literal);
+			APEX_Instruction *current_ins = &thread->code_memory[get_code_index(iq_entry->pc_value)];
+			log_printf("%s,R%d,#%d ", opcode, current_ins->rs1, iq_entry->literal);
 		}
 		if(iq_entry) {
-			printf("[%s,P%d,#%d]", opcode, iq_entry->src1_tag, iq_entry->literal);
+			log_printf("[%s,P%d,#%d]", opcode, iq_entry->src1_tag, iq_entry->literal);
 		}
-	} else if (strcmp(opcode, "HALT") == 0 || strcmp(opcode, "HALT\n") == 0) {
-		printf("%s", opcode);
-	} else if (strcmp(opcode, "NOP") == 0) {
-		printf(" NOP");
-	} else if (stage->pc == 0 && ((strcmp(opcode, "") == 0) || (strcmp(opcode, "EMPTY") == 0))) {
-		strcpy(stage->opcode, "EMPTY");
-		printf(" EMPTY");
+	} else if (op == OP_HALT) {
+		log_printf("%s", opcode);
+	} else if (op == OP_NOP) {
+		log_printf(" NOP");
+	} else if (stage->pc == 0 && op == OP_EMPTY) {
+		log_printf(" EMPTY");
 	}
 }
 
@@ -224,197 +607,910 @@ print_instruction(CPU_Stage *stage, APEX_CPU* cpu, IQ_ENTRY* iq_entry, int from_
 static void
 print_stage_content(char *name, CPU_Stage *stage, int is_active, APEX_CPU* cpu, IQ_ENTRY* iq_entry, int from_stage)
 {
-	printf("%-15s ", name);
+	log_printf("%-15s ", name);
 	if (is_active)
 	{
 		//fprintf(stderr, "Test print stage 1 pc value-> %d", stage);
 		if(stage) {
-			printf("(I%d)", get_code_index(from_stage > DRF ? iq_entry->pc_value : stage->pc));
+			log_printf("(I%d)", get_code_index(from_stage > DRF ? iq_entry->pc_value : stage->pc));
 		}
 		print_instruction(stage, cpu, iq_entry, from_stage);
 		//fprintf(stderr, "Test print stage 2");
 	}
 	else
 	{
-		printf("EMPTY");
+		log_printf("EMPTY");
 	}
-	printf("\n");
+	log_printf("\n");
 }
 
 static void 
 print_lsq(APEX_CPU* cpu, LSQ_ENTRY* lsq_entry) {
-	APEX_Instruction *current_ins = &cpu->code_memory[get_code_index(lsq_entry->pc)];
-	if (strcmp(current_ins->opcode, "STORE") == 0) {
-		printf("%s,R%d,R%d,#%d ", current_ins->opcode, current_ins->rs1, current_ins->rs2, current_ins->imm);
-		//printf("%s,P%d,P%d,#%d ", current_ins->opcode, lsq_entry->src1_tag, cpu->rename_table[current_ins->rs2], current_ins->imm);
-	} else if(strcmp(current_ins->opcode, "STR") == 0) {
-		printf("%s,R%d,R%d,R%d ", current_ins->opcode, current_ins->rs1, current_ins->rs2, current_ins->rs3);
-		//printf("%s,P%d,P%d,P%d ", current_ins->opcode, lsq_entry->src1_tag, cpu->rename_table[current_ins->rs2], cpu->rename_table[current_ins->rs3]);
-	} else if(strcmp(current_ins->opcode, "LOAD") == 0) {
-		printf("%s,R%d,R%d,R%d ", current_ins->opcode, current_ins->rd, current_ins->rs1, current_ins->imm);
-		//printf("%s,R%d,R%d,#%d ", current_ins->opcode, lsq_entry->load_dest_reg, cpu->rename_table[current_ins->rs2], iq_entry->literal);
-	} else if(strcmp(current_ins->opcode, "LDR") == 0) {
-		printf("%s,R%d,R%d,R%d ", current_ins->opcode, current_ins->rd, current_ins->rs1, current_ins->rs2);
+	APEX_THREAD* thread = &cpu->threads[cpu->lsq_thread[lsq_entry - cpu->LSQ]];
+	APEX_Instruction *current_ins = &thread->code_memory[get_code_index(lsq_entry->pc)];
+	if (current_ins->op == OP_STORE || current_ins->op == OP_VSTORE) {
+		log_printf("%s,R%d,R%d,#%d ", current_ins->opcode, current_ins->rs1, current_ins->rs2, current_ins->imm);
+		//printf("%s,P%d,P%d,#%d ", current_ins->opcode, lsq_entry->src1_tag, thread->rename_table[current_ins->rs2], current_ins->imm);
+	} else if(current_ins->op == OP_STR) {
+		log_printf("%s,R%d,R%d,R%d ", current_ins->opcode, current_ins->rs1, current_ins->rs2, current_ins->rs3);
+		//printf("%s,P%d,P%d,P%d ", current_ins->opcode, lsq_entry->src1_tag, thread->rename_table[current_ins->rs2], thread->rename_table[current_ins->rs3]);
+	} else if(current_ins->op == OP_LOAD || current_ins->op == OP_VLOAD) {
+		log_printf("%s,R%d,R%d,R%d ", current_ins->opcode, current_ins->rd, current_ins->rs1, current_ins->imm);
+		//printf("%s,R%d,R%d,#%d ", current_ins->opcode, lsq_entry->load_dest_reg, thread->rename_table[current_ins->rs2], iq_entry->literal);
+	} else if(current_ins->op == OP_LDR) {
+		log_printf("%s,R%d,R%d,R%d ", current_ins->opcode, current_ins->rd, current_ins->rs1, current_ins->rs2);
 		//printf("%s,R%d,R%d,#%d ", iq_entry->opcode, iq_entry->des_physical_reg, iq_entry->src1_tag, iq_entry->src2_tag);
 	}
 }
 
+/* Writes the assembly form of current_ins into buffer, as print_rob shows it */
+int
+format_instruction(char* buffer, size_t size, APEX_Instruction* current_ins) {
+	buffer[0] = '\0';
+	if (current_ins->op == OP_STORE || current_ins->op == OP_VSTORE) {
+		return snprintf(buffer, size, "%s,R%d,R%d,#%d ", current_ins->opcode, current_ins->rs1, current_ins->rs2, current_ins->imm);
+	} else if (current_ins->op == OP_STR) {
+		return snprintf(buffer, size, "%s,R%d,R%d,R%d ", current_ins->opcode, current_ins->rs1, current_ins->rs2, current_ins->rs3);
+	} else if (current_ins->op == OP_ADD || current_ins->op == OP_SUB || current_ins->op == OP_MUL || current_ins->op == OP_AND ||
+      current_ins->op == OP_OR || current_ins->op == OP_EXOR || vector_alu_op(current_ins->op) >= 0) {
+		return snprintf(buffer, size, "%s,R%d,R%d,R%d ", current_ins->opcode, current_ins->rd, current_ins->rs1, current_ins->rs2);
+	} else if (current_ins->op == OP_ADDL || current_ins->op == OP_SUBL || current_ins->op == OP_LOAD || current_ins->op == OP_VLOAD) {
+		return snprintf(buffer, size, "%s,R%d,R%d,#%d ", current_ins->opcode, current_ins->rd, current_ins->rs1, current_ins->imm);
+	} else if (current_ins->op == OP_MOVC) {
+		return snprintf(buffer, size, "%s,R%d,#%d ", current_ins->opcode, current_ins->rd, current_ins->imm);
+	} else if (current_ins->op == OP_BZ || current_ins->op == OP_BNZ) {
+		return snprintf(buffer, size, "%s,#%d", current_ins->opcode, current_ins->imm);
+	} else if (current_ins->op == OP_JUMP) {
+		return snprintf(buffer, size, "%s,R%d,#%d", current_ins->opcode, current_ins->rs1, current_ins->imm);
+	} else if (current_ins->op == OP_HALT) {
+		return snprintf(buffer, size, "%s", current_ins->opcode);
+	}
+	return 0;
+}
+
 static void
-print_rob(APEX_CPU* cpu, int pc_value) {
-	APEX_Instruction *current_ins = &cpu->code_memory[get_code_index(pc_value)];
-	if (strcmp(current_ins->opcode, "STORE") == 0) {
-    	printf("%s,R%d,R%d,#%d ", current_ins->opcode, current_ins->rs1, current_ins->rs2, current_ins->imm);
-		//printf("[%s,P%d,P%d,#%d]", iq_entry->opcode, lsq_entry->src1_tag, iq_entry->src1_tag, iq_entry->literal);
-  	} else if (strcmp(current_ins->opcode, "STR") == 0) {
-    	printf("%s,R%d,R%d,R%d ", current_ins->opcode, current_ins->rs1, current_ins->rs2, current_ins->rs3);
-		//printf("[%s,P%d,P%d,P%d]", iq_entry->opcode, lsq_entry->src1_tag, iq_entry->src1_tag, iq_entry->src2_tag);
-  	} else if (strcmp(current_ins->opcode, "ADD") == 0 || strcmp(current_ins->opcode, "SUB") == 0 || strcmp(current_ins->opcode, "MUL") == 0 || strcmp(current_ins->opcode, "AND") == 0 ||
-      strcmp(current_ins->opcode, "OR") == 0 || strcmp(current_ins->opcode, "EX-OR") == 0) {
-    	printf("%s,R%d,R%d,R%d ", current_ins->opcode, current_ins->rd, current_ins->rs1, current_ins->rs2);
-		//printf("[%s,P%d,P%d,P%d]", iq_entry->opcode, iq_entry->des_physical_reg, iq_entry->src1_tag, iq_entry->src2_tag);
-   	} else if (strcmp(current_ins->opcode, "ADDL") == 0 || strcmp(current_ins->opcode, "SUBL") == 0 || strcmp(current_ins->opcode, "LOAD") == 0) {
-     	printf("%s,R%d,R%d,#%d ", current_ins->opcode, current_ins->rd, current_ins->rs1, current_ins->imm);
-		//printf("[%s,P%d,P%d,#%d]", current_ins->opcode, iq_entry->des_physical_reg, iq_entry->src1_tag, iq_entry->literal);
-  	} else if (strcmp(current_ins->opcode, "MOVC") == 0) {
-    	printf("%s,R%d,#%d ", current_ins->opcode, current_ins->rd, current_ins->imm);
-		//printf("[%s,P%d,#%d]", current_ins->opcode, iq_entry->des_physical_reg, iq_entry->literal);
-  	} else if (strcmp(current_ins->opcode, "BZ") == 0 || strcmp(current_ins->opcode, "BNZ") == 0) {
-    	printf("%s,#%d", current_ins->opcode, current_ins->imm);
-  	} else if (strcmp(current_ins->opcode, "JUMP") == 0) {
-    	printf("%s,R%d,#%d", current_ins->opcode, current_ins->rs1, current_ins->imm);
-		//printf("[%s,P%d,#%d]", iq_entry->opcode, iq_entry->src1_tag, iq_entry->literal);
-  	} else if (strcmp(current_ins->opcode, "HALT") == 0) {
-    	printf("%s", current_ins->opcode);
-  	}
-}
-
-int free_physical_registers(APEX_CPU* cpu, int rs1, int rs2, int rs3) {
-	int i,j;
-	for(i = 0; i < PRF_SIZE; i++) {
-		if(i == rs1 || i == rs2 || i == rs3) {
-			continue;
-		}
-		for(j=0; j < ARF_SIZE; j++) {
-			if(cpu->rename_table[j] == i) {
-				break;
-			}
+print_rob(APEX_THREAD* thread, int pc_value) {
+	char buffer[64];
+	format_instruction(buffer, sizeof(buffer), &thread->code_memory[get_code_index(pc_value)]);
+	log_printf("%s", buffer);
+}
+
+/*
+ * Fills in the wakeup/select arrays for the instruction just written to
+ * IQ[index]. src1_ready/src2_ready are the phys_regs_valid words read at
+ * dispatch; only exactly 1 counts as ready.
+ */
+static void
+iq_insert(APEX_CPU* cpu, int index, int src1_ready, int src2_ready) {
+	IQ_ENTRY* iq_entry = &cpu->IQ[index];
+	uint32_t bit = 1u << index;
+	int op = iq_entry->op;
+	int sources = 0;
+	if(op == OP_ADD || op == OP_SUB || op == OP_MUL || op == OP_AND || op == OP_OR || op == OP_EXOR || op == OP_LDR || op == OP_STR) {
+		sources = 2;
+	} else if(op == OP_ADDL || op == OP_SUBL || op == OP_JUMP || op == OP_LOAD || op == OP_STORE || op == OP_BZ || op == OP_BNZ
+		  || op == OP_VLOAD || op == OP_VSTORE) {
+		sources = 1;
+	}
+	cpu->iq_valid |= bit;
+	cpu->iq_src1_needed = sources >= 1 ? cpu->iq_src1_needed | bit : cpu->iq_src1_needed & ~bit;
+	cpu->iq_src2_needed = sources == 2 ? cpu->iq_src2_needed | bit : cpu->iq_src2_needed & ~bit;
+	cpu->iq_src1_ready = src1_ready == 1 ? cpu->iq_src1_ready | bit : cpu->iq_src1_ready & ~bit;
+	cpu->iq_src2_ready = src2_ready == 1 ? cpu->iq_src2_ready | bit : cpu->iq_src2_ready & ~bit;
+	cpu->iq_spec_src1 &= ~bit;
+	cpu->iq_spec_src2 &= ~bit;
+	iq_entry->spec_load = 0;
+	cpu->iq_lanes = iq_entry->lanes ? cpu->iq_lanes | bit : cpu->iq_lanes & ~bit;
+	cpu->iq_src1_tag[index] = iq_entry->src1_tag;
+	cpu->iq_src2_tag[index] = iq_entry->src2_tag;
+	cpu->iq_fu_type[index] = iq_entry->fu_type_needed;
+	cpu->iq_thread[index] = iq_entry->thread;
+	cpu->iq_bis_index[index] = iq_entry->bis_index;
+	cpu->iq_pc[index] = iq_entry->pc_value;
+}
+
+/* Occupied IQ entries whose tag array holds phys_reg */
+static uint32_t
+iq_tag_matches(APEX_CPU* cpu, const int8_t* tags, int phys_reg) {
+	uint32_t matches = 0;
+	for(int i = 0; i < IQ_SIZE; i++) {
+		matches |= (uint32_t) (tags[i] == phys_reg) << i;
+	}
+	return matches & cpu->iq_valid;
+}
+
+/* Value of a lane source, the ARF reset value for an arch register never renamed */
+static int
+lane_value(APEX_CPU* cpu, int phys_reg) {
+	return phys_reg > -1 ? cpu->phys_regs[phys_reg] : -1;
+}
+
+/* Whether all VLEN lane registers in tags hold their value */
+static int
+lanes_valid(APEX_CPU* cpu, const int8_t* tags) {
+	for(int lane = 0; lane < VLEN; lane++) {
+		if(tags[lane] > -1 && cpu->phys_regs_valid[tags[lane]] != 1) {
+			return 0;
 		}
-		if(j == ARF_SIZE && cpu->consumers[i] == 0) {
-			cpu->free_PR_list[i] = 1;
+	}
+	return 1;
+}
+
+/* Vector IQ entries whose lane sources are all valid; they have no src1/src2 to wake */
+static uint32_t
+iq_lanes_ready(APEX_CPU* cpu) {
+	uint32_t ready = 0;
+	for(uint32_t lanes = cpu->iq_lanes & cpu->iq_valid; lanes; lanes &= lanes - 1) {
+		int index = __builtin_ctz(lanes);
+		if(lanes_valid(cpu, cpu->IQ[index].lane_src1_tags) && lanes_valid(cpu, cpu->IQ[index].lane_src2_tags)) {
+			ready |= 1u << index;
 		}
 	}
-	return 0;
+	return ready;
+}
+
+/* Whether the store in lsq_entry has its data, every lane of it for a VSTORE */
+static int
+store_data_ready(APEX_CPU* cpu, LSQ_ENTRY* lsq_entry) {
+	return lsq_entry->lanes ? lanes_valid(cpu, lsq_entry->lane_tags) : lsq_entry->src1_valid == 1;
 }
+
 /*
- *  Fetch Stage of APEX Pipeline
- *
- *  Note : You are free to edit this function according to your
- * 				 implementation
+ * Broadcasts a result on phys_reg to the IQ. BZ/BNZ sources get the zero
+ * flag of value when flag_for_branches is set, the value itself otherwise.
  */
-int fetch(APEX_CPU *cpu)
-{
-	CPU_Stage *stage = &cpu->stage[F];
-	stage->is_empty = 0;
-	stage->stalled = 0;
-	fprintf(stderr, "Not yet segmentation fault -1\n");
-	if (!stop_fetch_decode && !stage->busy && !stage->stalled)
-	{
-		/* Store current PC in fetch latch */
-		stage->pc = cpu->pc;
-		fprintf(stderr, "Not yet segmentation fault %d\n", stage->pc);
-		/* Index into code memory using this pc and copy all instruction fields into
-		 * fetch latch
-		 */
-		APEX_Instruction *current_ins = &cpu->code_memory[get_code_index(cpu->pc)];
-		strcpy(stage->opcode, current_ins->opcode);
-		stage->rd = current_ins->rd;
-		stage->rs1 = current_ins->rs1;
-		stage->rs2 = current_ins->rs2;
-		stage->rs3 = current_ins->rs3;
-		stage->imm = current_ins->imm;
-
-		/* Copy data from fetch latch to decode latch*/
-		if (!(&cpu->stage[DRF])->stalled) {
-			cpu->stage[DRF] = cpu->stage[F];
-			current_ins->stage_finished = F;
-			int i;
-			for (i = 0; i < BTB_SIZE; i++) {
-				if (cpu->BTB[i].branch_ins_pc_value == stage->pc && cpu->BTB[i].history_bit == 1) {
-					cpu->pc = cpu->BTB[i].target_pc_value; // Take the branch
-					break;
-				}
-			}
-			if(i == BTB_SIZE) {
-				cpu->pc += 4;
-			}
+static void
+iq_wakeup(APEX_CPU* cpu, int phys_reg, int value, int flag_for_branches) {
+	uint32_t matches = iq_tag_matches(cpu, cpu->iq_src1_tag, phys_reg);
+	cpu->iq_src1_ready |= matches;
+	for(; matches; matches &= matches - 1) {
+		IQ_ENTRY* iq_entry = &cpu->IQ[__builtin_ctz(matches)];
+		if(flag_for_branches && (iq_entry->op == OP_BZ || iq_entry->op == OP_BNZ)) {
+			iq_entry->src1_value = (value == 0);
 		} else {
-			fprintf(stderr, "Not yet segmentation fault -2\n");
-			stage->stalled = 1;
+			iq_entry->src1_value = value;
 		}
 	}
-	stage->is_empty = 1;
-	fprintf(stderr, "Not yet segmentation fault\n");
-	if (ENABLE_DEBUG_MESSAGES){
-		print_stage_content("Instruction at FETCH_____STAGE--->\t", stage, !stage->stalled && get_code_index(stage->pc) < cpu->code_memory_size, cpu, NULL, F);
+	matches = iq_tag_matches(cpu, cpu->iq_src2_tag, phys_reg);
+	cpu->iq_src2_ready |= matches;
+	for(; matches; matches &= matches - 1) {
+		cpu->IQ[__builtin_ctz(matches)].src2_value = value;
 	}
-			fprintf(stderr, "Not yet segmentation fault 2\n");
-	return 0;
 }
 
 /*
- *  Decode Stage of APEX Pipeline
- *
- *  Note : You are free to edit this function according to your
- * 				 implementation
+ * Load hit speculation: the load writing phys_reg returns value next
+ * cycle if it hits in the L1, so the IQ entries waiting on it get value
+ * and are marked ready now to issue back to back with it. JUMP resolves
+ * in the cycle the load would be cancelled and waits for the load as it
+ * is. Returns 1 if any entry was woken.
  */
-int decode(APEX_CPU *cpu)
+static int
+iq_speculative_wakeup(APEX_CPU* cpu, int phys_reg, int value) {
+	uint32_t branch_unit = 0;
+	for(int i = 0; i < IQ_SIZE; i++) {
+		branch_unit |= (uint32_t) (cpu->iq_fu_type[i] == BRANCH) << i;
+	}
+	cpu->iq_spec_src1 = iq_tag_matches(cpu, cpu->iq_src1_tag, phys_reg) & cpu->iq_src1_needed & ~cpu->iq_src1_ready & ~branch_unit;
+	cpu->iq_spec_src2 = iq_tag_matches(cpu, cpu->iq_src2_tag, phys_reg) & cpu->iq_src2_needed & ~cpu->iq_src2_ready & ~branch_unit;
+	cpu->iq_src1_ready |= cpu->iq_spec_src1;
+	cpu->iq_src2_ready |= cpu->iq_spec_src2;
+	cpu->spec_epoch += 1;
+	for(uint32_t woken = cpu->iq_spec_src1; woken; woken &= woken - 1) {
+		cpu->IQ[__builtin_ctz(woken)].src1_value = value;
+	}
+	for(uint32_t woken = cpu->iq_spec_src2; woken; woken &= woken - 1) {
+		cpu->IQ[__builtin_ctz(woken)].src2_value = value;
+	}
+	for(uint32_t woken = cpu->iq_spec_src1 | cpu->iq_spec_src2; woken; woken &= woken - 1) {
+		cpu->IQ[__builtin_ctz(woken)].spec_load = cpu->spec_epoch;
+	}
+	return (cpu->iq_spec_src1 | cpu->iq_spec_src2) != 0;
+}
+
+/* Takes IQ[index] out of the queue at issue, keeping the slot if it issued on a speculative wakeup */
+static void
+iq_issued(APEX_CPU* cpu, int index) {
+	uint32_t bit = 1u << index;
+	cpu->iq_valid &= ~bit;
+	if((cpu->iq_spec_src1 | cpu->iq_spec_src2) & bit) {
+		cpu->iq_held |= bit;
+	}
+}
+
+/* Ends the speculative wakeup, entries still in the IQ issue as if woken by the load */
+static void
+end_speculative_wakeup(APEX_CPU* cpu) {
+	for(uint32_t woken = cpu->iq_spec_src1 | cpu->iq_spec_src2; woken; woken &= woken - 1) {
+		cpu->IQ[__builtin_ctz(woken)].spec_load = 0;
+	}
+	cpu->iq_held = cpu->iq_spec_src1 = cpu->iq_spec_src2 = 0;
+	cpu->spec_load_reg = -1;
+}
+
+/*
+ * The speculated load hit with the value its dependents were woken with.
+ * Those issued last cycle execute on it now, their IQ slots are released.
+ */
+static void
+confirm_speculative_wakeup(APEX_CPU* cpu) {
+	end_speculative_wakeup(cpu);
+}
+
+/*
+ * The speculated load missed, or read another value than it woke its
+ * dependents with. Every entry woken early waits for the load again and
+ * the dependents issued last cycle are put back in the IQ. Their copies
+ * in the FUs are dropped by the next stage, see cancelled_issue().
+ */
+static void
+cancel_speculative_wakeup(APEX_CPU* cpu) {
+	cpu->iq_src1_ready &= ~cpu->iq_spec_src1;
+	cpu->iq_src2_ready &= ~cpu->iq_spec_src2;
+	cpu->iq_valid |= cpu->iq_held;
+	cpu->spec_cancelled = cpu->spec_epoch;
+	cpu->spec_replays += 1;
+	end_speculative_wakeup(cpu);
+}
+
+/*
+ * Run by INT2 and MUL2 on the instruction in stage before anything else.
+ * One issued on a speculative load wakeup that was cancelled last cycle,
+ * as it executed in INT1/MUL1, is back in the IQ, so this copy of it is
+ * dropped and 1 returned.
+ */
+static int
+cancelled_issue(APEX_CPU* cpu, CPU_Stage* stage) {
+	IQ_ENTRY* iq_entry = &stage->iq_entry;
+	if(!iq_entry->spec_load || iq_entry->stage_finished >= NUM_STAGES) {
+		return 0;
+	}
+	int cancelled = iq_entry->spec_load == cpu->spec_cancelled;
+	iq_entry->spec_load = 0;
+	if(!cancelled) {
+		cpu->spec_early_issues += 1;
+		return 0;
+	}
+	cpu->spec_wasted_issues += 1;
+	stage->op = OP_NOP;
+	iq_entry->stage_finished = NUM_STAGES;
+	return 1;
+}
+
+/* Maps arch register rd of thread to phys_reg, returning the register it was mapped to */
+static int
+rename_register(APEX_CPU* cpu, APEX_THREAD* thread, int rd, int phys_reg) {
+	int previous = thread->rename_table[rd];
+	thread->rename_table[rd] = phys_reg;
+	cpu->rename_refs[phys_reg] += 1;
+	if(previous > -1) {
+		cpu->rename_refs[previous] -= 1;
+	}
+	return previous;
+}
+/* Next PC after pc: the BTB target if it predicts the branch at pc taken */
+static int
+predict_next_pc(APEX_THREAD *thread, int pc)
 {
-	CPU_Stage *stage = &cpu->stage[DRF];
-	stage->stalled = 0;
-	stage->is_empty = 0;
-	APEX_Instruction *current_ins = &cpu->code_memory[get_code_index(stage->pc)];
-	if (!stop_fetch_decode && cpu->clock > 0 && !stage->busy && !stage->stalled && strcmp(stage->opcode, "NOP") != 0 && current_ins->stage_finished < DRF)
+	for (int i = 0; i < BTB_SIZE; i++) {
+		if (thread->BTB[i].branch_ins_pc_value == pc && thread->BTB[i].history_bit == 1) {
+			return thread->BTB[i].target_pc_value; // Take the branch
+		}
+	}
+	return pc + 4;
+}
+
+/* Copies the fields of the instruction at pc into the latch fetch fills */
+static void
+fill_fetch_latch(CPU_Stage *stage, APEX_Instruction *current_ins, int pc)
+{
+	stage->busy = 0;
+	stage->stalled = 0;
+	stage->is_empty = 0;
+	stage->pc = pc;
+	stage->op = current_ins->op;
+	stage->rd = current_ins->rd;
+	stage->rs1 = current_ins->rs1;
+	stage->rs2 = current_ins->rs2;
+	stage->rs3 = current_ins->rs3;
+	stage->imm = current_ins->imm;
+}
+
+/*
+ * Loop stream detector, shown each instruction fetch hands to decode
+ * with the PC predicted after it. Once the same BZ/BNZ has been
+ * predicted taken backwards LOOP_DETECT_ITERATIONS times and the body
+ * it closes is straight line code fitting the loop buffer, the body is
+ * captured and fetch streams it from the loop start. The BTB predicts
+ * nothing else inside such a body, so streaming follows the same path
+ * fetch would until the loop branch mispredicts and flushes.
+ */
+static void
+detect_loop(APEX_CPU *cpu, APEX_THREAD *thread, APEX_Instruction *current_ins, int pc, int next_pc)
+{
+	LOOP_BUFFER *loop = &thread->loop_buffer;
+	if (next_pc >= pc || !cpu->loop_buffer_enabled) {
+		return;
+	}
+	int length = (pc - next_pc) / 4 + 1;
+	if (length > LOOP_BUFFER_SIZE || (current_ins->op != OP_BZ && current_ins->op != OP_BNZ)) {
+		return;
+	}
+	if (loop->candidate_pc != pc) {
+		loop->candidate_pc = pc;
+		loop->iterations = 0;
+	}
+	loop->iterations += 1;
+	if (loop->iterations < LOOP_DETECT_ITERATIONS) {
+		return;
+	}
+	for (int i = 0; i < length - 1; i++) {
+		int index = get_code_index(next_pc + 4 * i);
+		if (index < 0 || index >= thread->code_memory_size) {
+			return;
+		}
+		APEX_Instruction *body_ins = &thread->code_memory[index];
+		if (body_ins->op == OP_BZ || body_ins->op == OP_BNZ
+		    || body_ins->op == OP_JUMP || body_ins->op == OP_HALT) {
+			return;
+		}
+		loop->body[i] = body_ins;
+	}
+	loop->body[length - 1] = current_ins;
+	loop->start_pc = next_pc;
+	loop->length = length;
+	loop->next = 0;
+	loop->streaming = 1;
+	cpu->loops_streamed += 1;
+	/* Whatever the decoupled front end queued beyond the branch is replayed from the buffer */
+	thread->pc = next_pc;
+	thread->ftq_count = thread->fetch_buffer_count = 0;
+}
+
+/* Next instruction of the streamed loop body, advancing thread->pc past it */
+static APEX_Instruction *
+stream_loop(APEX_CPU *cpu, APEX_THREAD *thread)
+{
+	LOOP_BUFFER *loop = &thread->loop_buffer;
+	APEX_Instruction *current_ins = loop->body[loop->next];
+	loop->next = loop->next + 1 == loop->length ? 0 : loop->next + 1;
+	thread->pc = loop->start_pc + 4 * loop->next;
+	cpu->streamed_instructions += 1;
+	return current_ins;
+}
+
+/*
+ * Branch prediction stage of the decoupled front end: queues the fetch
+ * block starting at thread->pc in the FTQ and moves pc past it.
+ */
+static void
+predict_fetch_block(APEX_CPU *cpu, APEX_THREAD *thread)
+{
+	if (thread->ftq_count == FTQ_SIZE || thread->pc < 4000 || get_code_index(thread->pc) >= thread->code_memory_size) {
+		return;
+	}
+	int line_words = cpu->icache->config.line_words;
+	int line_end = (int) (icache_line(cpu->icache, thread->pc) + 1) * line_words * 4;
+	FETCH_BLOCK *block = &thread->FTQ[(thread->ftq_head + thread->ftq_count) % FTQ_SIZE];
+	block->pc = thread->pc;
+	block->count = 0;
+	int pc = thread->pc;
+	for (;;) {
+		int next_pc = predict_next_pc(thread, pc);
+		int taken = next_pc != pc + 4;
+		block->count += 1;
+		pc = next_pc;
+		if (taken || pc >= line_end || get_code_index(pc) >= thread->code_memory_size) {
+			break;
+		}
+	}
+	thread->pc = pc;
+	thread->ftq_count += 1;
+	cpu->ftq_blocks += 1;
+}
+
+/*
+ * I-cache stage of the decoupled front end: fetches what is left of the
+ * FTQ head block into the fetch buffer once its line hits, and
+ * prefetches the lines of the blocks queued behind it.
+ */
+static void
+fetch_from_icache(APEX_CPU *cpu, APEX_THREAD *thread)
+{
+	int space = thread - cpu->threads;
+	if (thread->ftq_count > 0 && thread->fetch_buffer_count < FETCH_BUFFER_SIZE) {
+		FETCH_BLOCK *block = &thread->FTQ[thread->ftq_head];
+		if (icache_fetch(cpu->icache, space, block->pc, cpu->clock)) {
+			while (block->count > 0 && thread->fetch_buffer_count < FETCH_BUFFER_SIZE) {
+				int tail = (thread->fetch_buffer_head + thread->fetch_buffer_count) % FETCH_BUFFER_SIZE;
+				thread->fetch_buffer[tail] = block->pc;
+				thread->fetch_buffer_count += 1;
+				block->pc += 4;
+				block->count -= 1;
+			}
+			if (block->count == 0) {
+				thread->ftq_head = (thread->ftq_head + 1) % FTQ_SIZE;
+				thread->ftq_count -= 1;
+			}
+		}
+	}
+	for (int i = 1; i < thread->ftq_count; i++) {
+		icache_prefetch(cpu->icache, space, thread->FTQ[(thread->ftq_head + i) % FTQ_SIZE].pc, cpu->clock);
+	}
+}
+
+/*
+ * Fetch with the decoupled front end: hands the oldest fetched
+ * instruction to decode, then runs the I-cache and branch prediction
+ * stages, which keep the fetch buffer and FTQ filling while decode is
+ * stalled.
+ */
+static int
+fetch_decoupled(APEX_CPU *cpu, APEX_THREAD *thread)
+{
+	CPU_Stage *stage = NULL;
+	if (thread->stop_fetch_decode) {
+		/* Nothing to do */
+	} else if (thread->loop_buffer.streaming) {
+		/* The loop buffer stands in for the FTQ, I-cache and fetch buffer */
+		if (!thread->latch[DRF].held) {
+			int pc = thread->pc;
+			APEX_Instruction *current_ins = stream_loop(cpu, thread);
+			stage = latch_fill(&thread->latch[DRF]);
+			thread->latch[F].cur = stage;
+			fill_fetch_latch(stage, current_ins, pc);
+			stage->seq = ++cpu->next_seq;
+			trace_event(cpu->trace, TRACE_FETCH, stage->seq, stage->pc, cpu->clock);
+			current_ins->stage_finished = F;
+		}
+	} else {
+		if (thread->fetch_buffer_count == 0) {
+			cpu->fetch_buffer_empty_cycles += 1;
+		} else if (!thread->latch[DRF].held) {
+			int pc = thread->fetch_buffer[thread->fetch_buffer_head];
+			thread->fetch_buffer_head = (thread->fetch_buffer_head + 1) % FETCH_BUFFER_SIZE;
+			thread->fetch_buffer_count -= 1;
+			APEX_Instruction *current_ins = &thread->code_memory[get_code_index(pc)];
+			stage = latch_fill(&thread->latch[DRF]);
+			thread->latch[F].cur = stage;
+			fill_fetch_latch(stage, current_ins, pc);
+			stage->seq = ++cpu->next_seq;
+			trace_event(cpu->trace, TRACE_FETCH, stage->seq, stage->pc, cpu->clock);
+			current_ins->stage_finished = F;
+			detect_loop(cpu, thread, current_ins, pc, predict_next_pc(thread, pc));
+		}
+		if (!thread->loop_buffer.streaming) {
+			fetch_from_icache(cpu, thread);
+			predict_fetch_block(cpu, thread);
+		}
+	}
+	if (LOG_ENABLED(LOG_FETCH, LOG_DEBUG)) {
+		print_stage_content("Instruction at FETCH_____STAGE--->\t", stage, stage != NULL, cpu, NULL, F);
+	}
+	return 0;
+}
+
+/*
+ *  Fetch Stage of APEX Pipeline
+ *
+ *  Note : You are free to edit this function according to your
+ * 				 implementation
+ */
+int fetch(APEX_CPU *cpu)
+{
+	APEX_THREAD *thread = &cpu->threads[cpu->front_end_thread];
+	if (cpu->icache) {
+		return fetch_decoupled(cpu, thread);
+	}
+	CPU_LATCH *fetch_latch = &thread->latch[F];
+	CPU_Stage *stage = fetch_latch->cur;
+	int stalled = 0;
+	/* Nothing to fetch once the PC runs off the end of code memory */
+	if (!thread->stop_fetch_decode && get_code_index(thread->pc) < thread->code_memory_size)
+	{
+		/* Fetch straight into decode's latch, or into fetch's own buffer while decode holds */
+		stalled = thread->latch[DRF].held;
+		stage = stalled ? fetch_latch->next : latch_fill(&thread->latch[DRF]);
+		fetch_latch->cur = stage;
+		APEX_LOG(LOG_FETCH, LOG_TRACE, "fetch pc %d\n", thread->pc);
+		/* Index into code memory using this pc and copy all instruction fields into
+		 * fetch latch
+		 */
+		LOOP_BUFFER *loop = &thread->loop_buffer;
+		APEX_Instruction *current_ins = loop->streaming ? loop->body[loop->next] : &thread->code_memory[get_code_index(thread->pc)];
+		fill_fetch_latch(stage, current_ins, thread->pc);
+
+		if (!stalled) {
+			stage->seq = ++cpu->next_seq;
+			trace_event(cpu->trace, TRACE_FETCH, stage->seq, stage->pc, cpu->clock);
+			current_ins->stage_finished = F;
+			if (loop->streaming) {
+				stream_loop(cpu, thread);
+			} else {
+				thread->pc = predict_next_pc(thread, stage->pc);
+				detect_loop(cpu, thread, current_ins, stage->pc, thread->pc);
+			}
+		} else {
+			APEX_LOG(LOG_FETCH, LOG_TRACE, "fetch stalled, decode latch busy\n");
+		}
+	}
+	if (LOG_ENABLED(LOG_FETCH, LOG_DEBUG)) {
+		print_stage_content("Instruction at FETCH_____STAGE--->\t", stage, !stalled && get_code_index(stage->pc) < thread->code_memory_size, cpu, NULL, F);
+	}
+	return 0;
+}
+
+/*
+ * The instruction after the one at pc, if it is the one the front end
+ * hands to decode next: the one fetched into the decode latch behind it
+ * while it stalled, else the fetch PC or, with the decoupled front end,
+ * the fetch buffer head. Decode may fuse the two without waiting for it.
+ */
+static APEX_Instruction *
+next_in_front_end(APEX_CPU *cpu, APEX_THREAD *thread, int pc)
+{
+	int next_pc = pc + 4;
+	int index = get_code_index(next_pc);
+	if (index < 0 || index >= thread->code_memory_size) {
+		return NULL;
+	}
+	if (thread->latch[DRF].written) {
+		if (thread->latch[DRF].next->pc != next_pc) {
+			return NULL;
+		}
+	} else if (cpu->icache && !thread->loop_buffer.streaming) {
+		if (thread->fetch_buffer_count == 0 || thread->fetch_buffer[thread->fetch_buffer_head] != next_pc) {
+			return NULL;
+		}
+	} else if (thread->pc != next_pc) {
+		return NULL;
+	}
+	return &thread->code_memory[index];
+}
+
+/*
+ * Takes the instruction next_in_front_end() returned for pc out of the
+ * front end, as fetch would have handed it to decode, and returns the
+ * sequence number it gets.
+ */
+static int
+take_from_front_end(APEX_CPU *cpu, APEX_THREAD *thread, APEX_Instruction *next_ins, int pc)
+{
+	int next_pc = pc + 4;
+	next_ins->stage_finished = DRF;
+	if (thread->latch[DRF].written) {
+		/* Already fetched, the front end has moved past it */
+		thread->latch[DRF].written = 0;
+		return thread->latch[DRF].next->seq;
+	}
+	int seq = ++cpu->next_seq;
+	trace_event(cpu->trace, TRACE_FETCH, seq, next_pc, cpu->clock);
+	if (thread->loop_buffer.streaming) {
+		stream_loop(cpu, thread);
+		return seq;
+	}
+	int predicted_pc = predict_next_pc(thread, next_pc);
+	if (cpu->icache) {
+		thread->fetch_buffer_head = (thread->fetch_buffer_head + 1) % FETCH_BUFFER_SIZE;
+		thread->fetch_buffer_count -= 1;
+	} else {
+		thread->pc = predicted_pc;
+	}
+	detect_loop(cpu, thread, next_ins, next_pc, predicted_pc);
+	return seq;
+}
+
+/*
+ * Macro-op fusion of the instruction in decode with next_ins behind it:
+ * an ADD/ADDL/SUB/SUBL with the BZ/BNZ testing its result, or a MOVC
+ * with the ADD/ADDL/SUB/SUBL/AND/OR/EX-OR reading its rd.
+ */
+static int
+fusion_of(CPU_Stage *stage, APEX_Instruction *next_ins)
+{
+	if (stage->op == OP_ADD || stage->op == OP_ADDL || stage->op == OP_SUB || stage->op == OP_SUBL) {
+		if (next_ins->op == OP_BZ) {
+			return FUSED_BZ;
+		}
+		if (next_ins->op == OP_BNZ) {
+			return FUSED_BNZ;
+		}
+		return FUSED_NONE;
+	}
+	if (stage->op == OP_MOVC && (next_ins->rs1 == stage->rd || next_ins->rs2 == stage->rd)
+	    && (next_ins->op == OP_ADD || next_ins->op == OP_ADDL || next_ins->op == OP_SUB || next_ins->op == OP_SUBL
+		|| next_ins->op == OP_AND || next_ins->op == OP_OR || next_ins->op == OP_EXOR)) {
+		return FUSED_MOVC;
+	}
+	return FUSED_NONE;
+}
+
+/*
+ * Move elimination: the physical register already holding the result of
+ * the instruction in decode, or -1. ADDL/SUBL Rd,Rs,#0 copy Rs once its
+ * value, and so the zero flag a BZ/BNZ would read, is known. SUB and
+ * EX-OR Rd,Rs,Rs and MOVC Rd,#0 give APEX_ZERO_REG, and a MOVC of a
+ * literal a ready register of the thread holds gives that register.
+ */
+static int
+eliminated_result(APEX_CPU *cpu, APEX_THREAD *thread, CPU_Stage *stage)
+{
+	if ((stage->op == OP_ADDL || stage->op == OP_SUBL) && stage->imm == 0) {
+		int phys_reg = stage->rs1 > -1 ? thread->rename_table[stage->rs1] : -1;
+		return phys_reg > -1 && cpu->phys_regs_valid[phys_reg] == 1 ? phys_reg : -1;
+	}
+	if ((stage->op == OP_SUB || stage->op == OP_EXOR) && stage->rs1 == stage->rs2) {
+		return APEX_ZERO_REG;
+	}
+	if (stage->op == OP_MOVC) {
+		if (stage->imm == 0) {
+			return APEX_ZERO_REG;
+		}
+		for (int r = 0; r < ARF_SIZE; r++) {
+			int phys_reg = thread->rename_table[r];
+			if (phys_reg > -1 && cpu->phys_regs_valid[phys_reg] == 1 && cpu->phys_regs[phys_reg] == stage->imm) {
+				return phys_reg;
+			}
+		}
+	}
+	return -1;
+}
+
+/* Value predictor entry the load at pc maps to */
+static LVP_ENTRY *
+lvp_entry(APEX_THREAD *thread, int pc)
+{
+	return &thread->LVP[(pc / 4) % LVP_SIZE];
+}
+
+/*
+ * Load value prediction at dispatch: with a confident entry for the load
+ * at pc, its destination phys_reg is made ready holding the predicted
+ * value, so dependents dispatched after it issue without waiting for
+ * memory. Returns 1 if it predicted.
+ */
+static int
+predict_load_value(APEX_CPU *cpu, APEX_THREAD *thread, int pc, int phys_reg)
+{
+	LVP_ENTRY *entry = lvp_entry(thread, pc);
+	if (entry->pc != pc || entry->confidence < LVP_CONFIDENT) {
+		return 0;
+	}
+	cpu->phys_regs[phys_reg] = entry->value;
+	cpu->phys_regs_valid[phys_reg] = 1;
+	return 1;
+}
+
+/* The tag of the youngest BZ/BNZ of thread in flight, -1 once all have committed */
+static int
+branch_tag(APEX_THREAD *thread)
+{
+	return thread->bis_current_size ? thread->bis_tail : -1;
+}
+
+/* Takes the BIS entry of the BZ/BNZ at pc, dispatched to the ROB tail, and gives it a BTB entry */
+static BIS_ENTRY *
+allocate_branch_tag(APEX_THREAD *thread, int pc)
+{
+	thread->bis_tail = (thread->bis_tail + 1) % BIS_SIZE;
+	if(thread->bis_head == -1) {
+		thread->bis_head = thread->bis_tail;
+	}
+	thread->bis_current_size += 1;
+	BIS_ENTRY *bis_entry = &thread->BIS[thread->bis_tail];
+	bis_entry->pc_value = pc;
+	bis_entry->rob_index = thread->rob_tail;
+
+	int is_present_in_btb = 0;
+	for (int i = 0; i < BTB_SIZE; i++) {
+		if ((&thread->BTB[i])->branch_ins_pc_value == pc) {
+			is_present_in_btb = 1;
+			break;
+		}
+	}
+	if (!is_present_in_btb) {
+		BTB_ENTRY* btb_entry = &thread->BTB[thread->btb_tail];
+		btb_entry->branch_ins_pc_value = pc;
+		btb_entry->history_bit = 0;
+		// Replace the oldest entry once all BTB_SIZE are in use
+		thread->btb_tail = (thread->btb_tail + 1) % BTB_SIZE;
+	}
+	return bis_entry;
+}
+
+/*
+ * Copies the rename table and free list into the checkpoint flush
+ * restores if bis_entry's branch mispredicts, one per BIS entry so a
+ * younger branch does not overwrite an older one's.
+ */
+static void
+checkpoint_rename_state(APEX_CPU *cpu, APEX_THREAD *thread, BIS_ENTRY *bis_entry)
+{
+	int i;
+	bis_entry->latest_arithmetic_phys_reg = thread->latest_arithmetic_inst_phys_reg;
+	if(bis_entry == &thread->BIS[0]) {
+		bis_entry->checkpoint_entry = 1;
+		for(i = 0; i < ARF_SIZE; i++) {
+			thread->checkpoint_rename_table_1[i] = thread->rename_table[i];
+		}
+		for(i = 0; i < cpu->prf_size; i++) {
+			thread->free_PR_list_checkpoint_1[i] = cpu->free_PR_list[i];
+		}
+	} else {
+		bis_entry->checkpoint_entry = 2;
+		for(i = 0; i < ARF_SIZE; i++) {
+			thread->checkpoint_rename_table_2[i] = thread->rename_table[i];
+		}
+		for(i = 0; i < cpu->prf_size; i++) {
+			thread->free_PR_list_checkpoint_2[i] = cpu->free_PR_list[i];
+		}
+	}
+	count_checkpoint(cpu, thread, bis_entry, 1);
+}
+
+/*
+ * Sets the unit iq_entry issues to and the latency and interval it has
+ * there from the machine description. A fused BZ/BNZ pair resolves in
+ * INT2 and stays on INT; LOAD/LDR/STORE/STR compute their address on
+ * INT, their access latency is the LSQ's.
+ */
+static void
+apply_timing(APEX_CPU *cpu, IQ_ENTRY *iq_entry, int op)
+{
+	const OPCODE_TIMING* timing = machine_timing(&cpu->machine, opcode_names[op]);
+	int unit = timing ? timing->unit : UNIT_INT;
+	if (unit == UNIT_MEM || iq_entry->fused == FUSED_BZ || iq_entry->fused == FUSED_BNZ) {
+		unit = UNIT_INT;
+	}
+	iq_entry->fu_type_needed = unit == UNIT_MUL ? MUL : (unit == UNIT_BRANCH ? BRANCH : INT);
+	iq_entry->extra_latency = 0;
+	iq_entry->issue_interval = 1;
+	if (timing && timing->unit != UNIT_MEM) {
+		iq_entry->extra_latency = timing->latency - machine_unit_stages(unit);
+		iq_entry->issue_interval = timing->interval;
+	}
+}
+
+/* Cycles the LSQ spends on the access of the LOAD/LDR/STORE/STR op */
+static uint8_t
+access_cycles(APEX_CPU *cpu, int op)
+{
+	const OPCODE_TIMING* timing = machine_timing(&cpu->machine, opcode_names[op]);
+	return timing ? timing->latency : 3;
+}
+
+/*
+ * Renames the VLEN lanes of the vector register starting at rd, each to
+ * a free register into lane_regs, with the register it was mapped to
+ * into previous. Decode has made sure there are VLEN free.
+ */
+static void
+rename_lanes(APEX_CPU *cpu, APEX_THREAD *thread, int rd, int8_t *lane_regs, int *previous)
+{
+	int lane = 0;
+	for (int i = 0; i < cpu->prf_size && lane < VLEN; i++) {
+		if (cpu->free_PR_list[i]) {
+			cpu->free_PR_list[i] = 0;
+			cpu->phys_regs_valid[i] = 0;
+			cpu->phys_reg_owner[i] = cpu->front_end_thread;
+			lane_regs[lane] = i;
+			previous[lane] = rename_register(cpu, thread, rd + lane, i);
+			lane++;
+		}
+	}
+}
+
+/*
+ *  Decode Stage of APEX Pipeline
+ *
+ *  Note : You are free to edit this function according to your
+ * 				 implementation
+ */
+int decode(APEX_CPU *cpu)
+{
+	APEX_THREAD *thread = &cpu->threads[cpu->front_end_thread];
+	CPU_Stage *stage = thread->latch[DRF].cur;
+	/* The path after a JUMP is not known before it resolves */
+	stage->stalled = thread->jump_pending;
+	stage->is_empty = 0;
+	APEX_Instruction *current_ins = &thread->code_memory[get_code_index(stage->pc)];
+	if (!thread->stop_fetch_decode && cpu->clock > 0 && !stage->busy && !stage->stalled && stage->op != OP_NOP && current_ins->stage_finished < DRF)
 	{
 		/* Read data from register file for store */
 		int is_stage_stalled = 0;
-		if (cpu->rob_current_size == ROB_SIZE) {
-			fprintf(stderr, "Stage stalled at decode rob\n");
+		if (thread->rob_current_size == cpu->rob_partition) {
+			APEX_LOG(LOG_DECODE, LOG_TRACE, "Stage stalled at decode rob\n");
 			is_stage_stalled = 1;
 		}
-		if (!is_stage_stalled && (strcmp(stage->opcode, "BZ") == 0 || strcmp(stage->opcode, "BNZ") == 0)) {
-			if (cpu->bis_current_size == BIS_SIZE) {
-				fprintf(stderr, "Stage stalled at decode bis\n");
+		if (!is_stage_stalled && (stage->op == OP_BZ || stage->op == OP_BNZ)) {
+			if (thread->bis_current_size == BIS_SIZE) {
+				APEX_LOG(LOG_DECODE, LOG_TRACE, "Stage stalled at decode bis\n");
 				is_stage_stalled = 1;
 			}
 		}
-		if (!is_stage_stalled && (strcmp(stage->opcode, "STORE") == 0 || strcmp(stage->opcode, "STR") == 0 || strcmp(stage->opcode, "LOAD") == 0 || strcmp(stage->opcode, "LDR") == 0)) {
+		/* Vector instructions read and write a physical register per lane */
+		int vector_alu = vector_alu_op(stage->op) >= 0;
+		int vector_load = stage->op == OP_VLOAD;
+		int vector_store = stage->op == OP_VSTORE;
+		if (!is_stage_stalled && (stage->op == OP_STORE || stage->op == OP_STR || stage->op == OP_LOAD || stage->op == OP_LDR || vector_load || vector_store)) {
 			if (cpu->lsq_current_size == LSQ_SIZE) {
-				fprintf(stderr, "Stage stalled at decode lsq\n");
+				APEX_LOG(LOG_DECODE, LOG_TRACE, "Stage stalled at decode lsq\n");
 				is_stage_stalled = 1;
 			}
 		}
 		IQ_ENTRY *iq_entry = NULL;
 		int i;
-		for (i = 0; i < IQ_SIZE; i++) {
-			if (cpu->iq_free[i] >= 1) {
-				//iq_entry = &cpu->IQ[i];
-				//cpu->iq_free[i] = 0;
-				break;
-			}
+		/* An eliminated move needs neither an IQ entry nor a new register */
+		int eliminated_phy_reg = -1;
+		if (cpu->move_elimination_enabled && !is_stage_stalled) {
+			eliminated_phy_reg = eliminated_result(cpu, thread, stage);
 		}
-		if (i == IQ_SIZE) {
+		if ((cpu->iq_valid | cpu->iq_held) == IQ_FULL_MASK && eliminated_phy_reg < 0) {
 			is_stage_stalled = 1;
 		}
+		/* Macro-op fusion with the instruction behind, when there is room for what the pair needs */
+		int fused = FUSED_NONE;
+		APEX_Instruction *fused_ins = NULL;
+		if (cpu->fusion_enabled && !is_stage_stalled && eliminated_phy_reg < 0 && (fused_ins = next_in_front_end(cpu, thread, stage->pc))) {
+			fused = fusion_of(stage, fused_ins);
+			int free_phy_regs = 0;
+			for (i = 0; i < cpu->prf_size; i++) {
+				free_phy_regs += cpu->free_PR_list[i] != 0;
+			}
+			if (((fused == FUSED_BZ || fused == FUSED_BNZ) && thread->bis_current_size == BIS_SIZE) || free_phy_regs < (fused == FUSED_MOVC ? 2 : 1)) {
+				fused = FUSED_NONE;
+			}
+		}
+		/* The other half of the pair, the MOVC until the BZ/BNZ is taken from the front end */
+		int fused_pc = stage->pc;
+		int fused_seq = stage->seq;
+		int fused_rd = stage->rd;
+		int fused_literal = stage->imm;
+		int fused_phy_reg = -1;
+		if (fused == FUSED_MOVC) {
+			/* The MOVC result is known now: its rd gets a register holding the literal, and
+			 * the ALU instruction reading it is decoded in its place, with it as a ready source
+			 */
+			for (i = 0; i < cpu->prf_size; i++) {
+				if (cpu->free_PR_list[i]) {
+					fused_phy_reg = i;
+					cpu->free_PR_list[i] = 0;
+					cpu->phys_regs[i] = stage->imm;
+					cpu->phys_regs_valid[i] = 1;
+					cpu->phys_reg_owner[i] = cpu->front_end_thread;
+					break;
+				}
+			}
+			int movc_previous_phy_reg = rename_register(cpu, thread, stage->rd, fused_phy_reg);
+			release_register(cpu, movc_previous_phy_reg);
+			trace_event(cpu->trace, TRACE_RENAME, stage->seq, stage->pc, cpu->clock);
+			trace_event(cpu->trace, TRACE_DISPATCH, stage->seq, stage->pc, cpu->clock);
+			trace_event(cpu->trace, TRACE_COMPLETE, stage->seq, stage->pc, cpu->clock);
+			current_ins->stage_finished = DRF;
+			int seq = take_from_front_end(cpu, thread, fused_ins, stage->pc);
+			fill_fetch_latch(stage, fused_ins, stage->pc + 4);
+			stage->seq = seq;
+			current_ins = fused_ins;
+			cpu->fused_movcs += 1;
+		}
 		int first_free_phy_reg = -1;
 		int previous_phy_reg = -1;
-		int rs1_physical = stage->rs1 > -1 ? cpu->rename_table[stage->rs1] : -1;
-		int rs2_physical = stage->rs2 > -1 ? cpu->rename_table[stage->rs2] : -1;
-		int rs3_physical = stage->rs3 > -1 ? cpu->rename_table[stage->rs3] : -1;
-		if(!is_stage_stalled) {
-			free_physical_registers(cpu, rs1_physical, rs2_physical, rs3_physical);
-		}
-		if (!(strcmp(stage->opcode, "STORE") == 0 || strcmp(stage->opcode, "STR") == 0 || strcmp(stage->opcode, "HALT") == 0 || strcmp(stage->opcode, "BZ") == 0 || strcmp(stage->opcode, "BNZ") == 0 || strcmp(stage->opcode, "JUMP") == 0)) {
-			for (i = 0; i < PRF_SIZE; i++) {
+		int rs1_physical = stage->rs1 > -1 ? thread->rename_table[stage->rs1] : -1;
+		int rs2_physical = stage->rs2 > -1 ? thread->rename_table[stage->rs2] : -1;
+		int rs3_physical = stage->rs3 > -1 ? thread->rename_table[stage->rs3] : -1;
+		int8_t lane_src1[VLEN];
+		int8_t lane_src2[VLEN];
+		int8_t lane_dest[VLEN];
+		int lane_previous[VLEN];
+		if (vector_alu || vector_store) {
+			for (i = 0; i < VLEN; i++) {
+				lane_src1[i] = thread->rename_table[stage->rs1 + i];
+				lane_src2[i] = vector_alu ? thread->rename_table[stage->rs2 + i] : -1;
+			}
+		}
+		if (eliminated_phy_reg < 0 && !(stage->op == OP_STORE || stage->op == OP_STR || stage->op == OP_HALT || stage->op == OP_BZ || stage->op == OP_BNZ || stage->op == OP_JUMP || vector_store)) {
+			int free_phy_regs = 0;
+			for (i = 0; i < cpu->prf_size; i++) {
 				if (cpu->free_PR_list[i]) {
 					first_free_phy_reg = i;
 					//cpu->free_PR_list[i] = 0;
@@ -424,54 +1520,99 @@ int decode(APEX_CPU *cpu)
 			}
 			if(!(first_free_phy_reg > -1)) {
 				is_stage_stalled = 1;
+			} else if(vector_alu || vector_load) {
+				for (i = first_free_phy_reg; i < cpu->prf_size; i++) {
+					free_phy_regs += cpu->free_PR_list[i] != 0;
+				}
+				is_stage_stalled = free_phy_regs < VLEN;
 			}
 		}
 		//fprintf(stderr, "Test Decode 1\n");
 		if (is_stage_stalled) {
 			stage->stalled = 1;
 		} else {
-			if (!(strcmp(stage->opcode, "STORE") == 0 || strcmp(stage->opcode, "STR") == 0 || strcmp(stage->opcode, "HALT") == 0 || strcmp(stage->opcode, "BZ") == 0 || strcmp(stage->opcode, "BNZ") == 0 || strcmp(stage->opcode, "JUMP") == 0)) {
-				for (i = 0; i < PRF_SIZE; i++) {
+			if (eliminated_phy_reg > -1) {
+				first_free_phy_reg = eliminated_phy_reg;
+				previous_phy_reg = rename_register(cpu, thread, stage->rd, eliminated_phy_reg);
+			} else if (vector_alu || vector_load) {
+				rename_lanes(cpu, thread, stage->rd, lane_dest, lane_previous);
+				first_free_phy_reg = lane_dest[0];
+			} else if (!(stage->op == OP_STORE || stage->op == OP_STR || stage->op == OP_HALT || stage->op == OP_BZ || stage->op == OP_BNZ || stage->op == OP_JUMP || vector_store)) {
+				for (i = 0; i < cpu->prf_size; i++) {
 					if (cpu->free_PR_list[i]) {
 						first_free_phy_reg = i;
 						cpu->free_PR_list[i] = 0;
 						cpu->phys_regs_valid[i] = 0;
+						cpu->phys_reg_owner[i] = cpu->front_end_thread;
 						break;
 					}
 				}
 				if(first_free_phy_reg > -1) {
 					//fprintf(stderr, "first  free  physical register %d %s\n", first_free_phy_reg, stage->opcode);
-					previous_phy_reg = cpu->rename_table[stage->rd];
-					cpu->rename_table[stage->rd] = first_free_phy_reg;
+					previous_phy_reg = rename_register(cpu, thread, stage->rd, first_free_phy_reg);
 				}
 			}
 			//fprintf(stderr, "Test Decode 2\n");
-			cpu->rob_tail = (cpu->rob_tail + 1) % ROB_SIZE;
-			cpu->rob_current_size += 1;
-			ROB_ENTRY *rob_entry = &cpu->ROB[cpu->rob_tail];
-			if(cpu->rob_head == -1) {
-				cpu->rob_head = cpu->rob_tail;
+			thread->rob_tail = (thread->rob_tail + 1) % ROB_SIZE;
+			thread->rob_current_size += 1;
+			ROB_ENTRY *rob_entry = &thread->ROB[thread->rob_tail];
+			if(thread->rob_head == -1) {
+				thread->rob_head = thread->rob_tail;
 			}
 			LSQ_ENTRY *lsq_entry;
 			BIS_ENTRY *bis_entry;
 
 			rob_entry->arch_register = stage->rd;
 			rob_entry->exception_codes = 0;
-			rob_entry->result_valid = 0;
+			thread->rob_done &= ~(1u << thread->rob_tail);
 			rob_entry->result = 0;
 			rob_entry->pc_value = stage->pc;
-			strcpy(rob_entry->instruction_type, stage->opcode);
+			rob_entry->op = current_ins->op;
 			rob_entry->phys_register = first_free_phy_reg;
+			thread->rob_seq[thread->rob_tail] = stage->seq;
+			rob_entry->fused = fused;
+			rob_entry->lanes = (vector_alu || vector_load) ? VLEN : 0;
+			if (rob_entry->lanes) {
+				memcpy(rob_entry->lane_phys_registers, lane_dest, sizeof(lane_dest));
+			}
+			if (fused == FUSED_MOVC) {
+				rob_entry->fused_arch_register = fused_rd;
+				rob_entry->fused_phys_register = fused_phy_reg;
+				rob_entry->fused_result = fused_literal;
+				rob_entry->fused_pc = fused_pc;
+				rob_entry->fused_seq = fused_seq;
+			}
+			set_rob_tags(thread, thread->rob_tail);
+			count_writers(cpu, thread, thread->rob_tail, 1);
 			cpu->execution_started = 1;
+			thread->recovery_pending = 0;
+			thread->last_dispatched_seq = stage->seq;
+			trace_event(cpu->trace, TRACE_RENAME, stage->seq, stage->pc, cpu->clock);
+			trace_event(cpu->trace, TRACE_DISPATCH, stage->seq, stage->pc, cpu->clock);
 			//fprintf(stderr, "Test Decode 3\n");
-			if(strcmp(stage->opcode, "HALT") == 0) {
+			if (eliminated_phy_reg > -1) {
+				/* Complete at rename, with the value the register already holds */
+				thread->rob_done |= 1u << thread->rob_tail;
+				rob_entry->result = cpu->phys_regs[eliminated_phy_reg];
+				trace_event(cpu->trace, TRACE_COMPLETE, stage->seq, stage->pc, cpu->clock);
+				if (stage->op == OP_ADDL || stage->op == OP_SUBL || stage->op == OP_SUB) {
+					cpu->flag_condition[eliminated_phy_reg] = (rob_entry->result == 0);
+					move_register_ref(cpu, cpu->checkpoint_refs, &thread->latest_arithmetic_inst_phys_reg, eliminated_phy_reg);
+				}
+				release_register(cpu, previous_phy_reg);
+				if (eliminated_phy_reg == APEX_ZERO_REG) {
+					cpu->eliminated_zeros += 1;
+				} else {
+					cpu->eliminated_moves += 1;
+				}
+			} else if(stage->op == OP_HALT) {
 				stage->stalled = 1;
-				(&cpu->stage[F])->stalled = 1;
-				stop_fetch_decode = 1;
-				rob_entry->result_valid = 1;
+				thread->stop_fetch_decode = 1;
+				thread->rob_done |= 1u << thread->rob_tail;
+				trace_event(cpu->trace, TRACE_COMPLETE, stage->seq, stage->pc, cpu->clock);
 			}else {
 				//fprintf(stderr, "Test Decode 4\n");
-				if (strcmp(stage->opcode, "STORE") == 0 || strcmp(stage->opcode, "STR") == 0) {
+				if (stage->op == OP_STORE || stage->op == OP_STR || vector_store) {
 					cpu->lsq_tail = (cpu->lsq_tail + 1) % LSQ_SIZE;
 					cpu->lsq_current_size += 1;
 					if(cpu->lsq_head == -1) {
@@ -481,156 +1622,169 @@ int decode(APEX_CPU *cpu)
 					lsq_entry->address_valid = 0;
 					lsq_entry->calculated_mem_address = 0;
 					lsq_entry->ins_type = 1;
-					lsq_entry->rob_index = cpu->rob_tail;
+					cpu->lsq_rob_index[cpu->lsq_tail] = thread->rob_tail;
 					lsq_entry->src1_tag = rs1_physical;
 					lsq_entry->value = cpu->phys_regs[rs1_physical];
 					lsq_entry->src1_valid = cpu->phys_regs_valid[rs1_physical];
-					lsq_entry->bis_index = cpu->bis_tail;
+					cpu->lsq_bis_index[cpu->lsq_tail] = branch_tag(thread);
 					lsq_entry->pc = stage->pc;
-				} else if (strcmp(stage->opcode, "LOAD") == 0 || strcmp(stage->opcode, "LDR") == 0) {
+					lsq_entry->dispatch_cycle = cpu->clock;
+					lsq_entry->l1_accessed = lsq_entry->l1_wait = 0;
+					lsq_entry->cycle_counter = 0;
+					lsq_entry->access_cycles = access_cycles(cpu, stage->op);
+					cpu->lsq_thread[cpu->lsq_tail] = cpu->front_end_thread;
+					lsq_entry->lanes = vector_store ? VLEN : 0;
+					if (vector_store) {
+						memcpy(lsq_entry->lane_tags, lane_src1, sizeof(lane_src1));
+					}
+				} else if (stage->op == OP_LOAD || stage->op == OP_LDR || vector_load) {
 					cpu->lsq_tail = (cpu->lsq_tail + 1) % LSQ_SIZE;
 					lsq_entry = &cpu->LSQ[cpu->lsq_tail];
+					cpu->lsq_current_size += 1;
+					if(cpu->lsq_head == -1) {
+						cpu->lsq_head = cpu->lsq_tail;
+					}
 					lsq_entry->address_valid = 0;
 					lsq_entry->calculated_mem_address = 0;
 					lsq_entry->ins_type = 0;
-					lsq_entry->rob_index = cpu->rob_tail;
+					cpu->lsq_rob_index[cpu->lsq_tail] = thread->rob_tail;
 					lsq_entry->load_dest_reg = first_free_phy_reg;
-					lsq_entry->bis_index = cpu->bis_tail;
+					cpu->lsq_bis_index[cpu->lsq_tail] = branch_tag(thread);
 					lsq_entry->pc = stage->pc;
+					lsq_entry->dispatch_cycle = cpu->clock;
+					lsq_entry->l1_accessed = lsq_entry->l1_wait = 0;
+					lsq_entry->cycle_counter = 0;
+					lsq_entry->access_cycles = access_cycles(cpu, stage->op);
+					cpu->lsq_thread[cpu->lsq_tail] = cpu->front_end_thread;
+					lsq_entry->lanes = vector_load ? VLEN : 0;
+					if (vector_load) {
+						memcpy(lsq_entry->lane_tags, lane_dest, sizeof(lane_dest));
+					}
+					lsq_entry->value_predicted = cpu->value_prediction_enabled && !vector_load && predict_load_value(cpu, thread, stage->pc, first_free_phy_reg);
 				}
 				//fprintf(stderr, "Test Decode 5\n");
-				if (strcmp(stage->opcode, "BZ") == 0 || strcmp(stage->opcode, "BNZ") == 0) {
-					cpu->bis_tail = (cpu->bis_tail + 1) % BIS_SIZE;
-					if(cpu->bis_head == -1) {
-						cpu->bis_head = cpu->bis_tail;
-					}
-					bis_entry = &cpu->BIS[cpu->bis_tail];
-					//fprintf(stderr, "Test Decode 51\n");
-					bis_entry->pc_value = stage->pc;
-					//fprintf(stderr, "Test Decode 5111\n");
-					bis_entry->rob_index = cpu->rob_tail;
-					
-					int is_present_in_btb = 0;
-					for (int i = 0; i < BTB_SIZE; i++) {
-						if ((&cpu->BTB[i])->branch_ins_pc_value == stage->pc) {
-							is_present_in_btb = 1;
-							break;
-						}
-					}
-					//fprintf(stderr, "Test Decode 52\n");
-					if (!is_present_in_btb) {
-						BTB_ENTRY* btb_entry = &cpu->BTB[cpu->btb_tail];
-						btb_entry->branch_ins_pc_value = stage->pc;
-						btb_entry->history_bit = 0;
-						cpu->btb_tail += 1;
-					}
+				if (stage->op == OP_BZ || stage->op == OP_BNZ) {
+					bis_entry = allocate_branch_tag(thread, stage->pc);
 				}
 				//fprintf(stderr, "Test decode 6\n");
-				for (i = 0; i < IQ_SIZE; i++) {
-					if (cpu->iq_free[i] >= 1) {
-						iq_entry = &cpu->IQ[i];
-						cpu->iq_free[i] = 0;
-						break;
-					}
-				}
-				strcpy(iq_entry->opcode, stage->opcode);
-				if(strcmp(stage->opcode, "STR") == 0) {
+				int iq_index = __builtin_ctz(~(cpu->iq_valid | cpu->iq_held));
+				iq_entry = &cpu->IQ[iq_index];
+				iq_entry->op = stage->op;
+				if(stage->op == OP_STR) {
 					cpu->consumers[rs2_physical] += 1;
 					cpu->consumers[rs3_physical] += 1;
-				} else if(strcmp(stage->opcode, "BZ") == 0 || strcmp(stage->opcode, "BNZ") == 0) {
-					cpu->consumers[cpu->latest_arithmetic_inst_phys_reg] += 1;
-				} else if(strcmp(stage->opcode, "ADD") == 0 || strcmp(stage->opcode, "ADDL") == 0 || strcmp(stage->opcode, "SUB") == 0 || strcmp(stage->opcode, "AND") == 0 || strcmp(stage->opcode, "OR") == 0 || strcmp(stage->opcode, "EX-OR") == 0 || strcmp(stage->opcode, "SUBL") == 0 || strcmp(stage->opcode, "MUL") == 0 || strcmp(stage->opcode, "LDR") == 0) {
+				} else if(stage->op == OP_BZ || stage->op == OP_BNZ) {
+					cpu->consumers[thread->latest_arithmetic_inst_phys_reg] += 1;
+				} else if(stage->op == OP_ADD || stage->op == OP_ADDL || stage->op == OP_SUB || stage->op == OP_AND || stage->op == OP_OR || stage->op == OP_EXOR || stage->op == OP_SUBL || stage->op == OP_MUL || stage->op == OP_LDR) {
 					cpu->consumers[rs1_physical] += 1;
+					// ADDL and SUBL have no rs2, whose -1 would count against the register before consumers
+					if(rs2_physical > -1) {
+						cpu->consumers[rs2_physical] += 1;
+					}
+				} else if(stage->op == OP_STORE || vector_store) {
 					cpu->consumers[rs2_physical] += 1;
-				} else if(strcmp("STORE", stage->opcode) == 0) {
-					cpu->consumers[rs2_physical] += 1;
-				} else if(strcmp("JUMP", stage->opcode) == 0 || strcmp("LOAD", stage->opcode) == 0) {
+				} else if(stage->op == OP_JUMP || stage->op == OP_LOAD || vector_load) {
 					cpu->consumers[rs1_physical] += 1;
 				} 
-				iq_entry->src1_value = (strcmp(stage->opcode, "STR") == 0 || strcmp(stage->opcode, "STORE") == 0) ? cpu->phys_regs[rs2_physical] : ((strcmp(stage->opcode, "BZ") == 0 || strcmp(stage->opcode, "BNZ") == 0) ? cpu->flag_condition[cpu->latest_arithmetic_inst_phys_reg] : cpu->phys_regs[rs1_physical]);
-				iq_entry->src2_value = (strcmp(stage->opcode, "STR") == 0) ? cpu->phys_regs[rs3_physical] : cpu->phys_regs[rs2_physical];
-				iq_entry->src2_tag = (strcmp(stage->opcode, "STR") == 0) ? rs3_physical : rs2_physical;
-				iq_entry->src1_tag = (strcmp(stage->opcode, "STR") == 0 || strcmp(stage->opcode, "STORE") == 0) ? rs2_physical : ((strcmp(stage->opcode, "BZ") == 0 || strcmp(stage->opcode, "BNZ") == 0) ? cpu->latest_arithmetic_inst_phys_reg : rs1_physical);
-				iq_entry->src2_ready = (strcmp(stage->opcode, "STR") == 0) ? cpu->phys_regs_valid[rs3_physical] : cpu->phys_regs_valid[rs2_physical];
-				iq_entry->src1_ready = (strcmp(stage->opcode, "STR") == 0 || strcmp(stage->opcode, "STORE") == 0) ? cpu->phys_regs_valid[rs2_physical] : ((strcmp(stage->opcode, "BZ") == 0 || strcmp(stage->opcode, "BNZ") == 0) ? cpu->phys_regs_valid[cpu->latest_arithmetic_inst_phys_reg] : cpu->phys_regs_valid[rs1_physical]);
+				/* Lane sources are read at execution, or by the LSQ for VSTORE data */
+				if (vector_alu || vector_store) {
+					for (i = 0; i < VLEN; i++) {
+						if (lane_src1[i] > -1) {
+							cpu->consumers[lane_src1[i]] += 1;
+						}
+						if (lane_src2[i] > -1) {
+							cpu->consumers[lane_src2[i]] += 1;
+						}
+					}
+				}
+				iq_entry->lanes = vector_alu ? VLEN : 0;
+				if (vector_alu) {
+					memcpy(iq_entry->lane_src1_tags, lane_src1, sizeof(lane_src1));
+					memcpy(iq_entry->lane_src2_tags, lane_src2, sizeof(lane_src2));
+					memcpy(iq_entry->lane_dest_regs, lane_dest, sizeof(lane_dest));
+				}
+				iq_entry->src1_value = (stage->op == OP_STR || stage->op == OP_STORE || vector_store) ? cpu->phys_regs[rs2_physical] : ((stage->op == OP_BZ || stage->op == OP_BNZ) ? cpu->flag_condition[thread->latest_arithmetic_inst_phys_reg] : cpu->phys_regs[rs1_physical]);
+				iq_entry->src2_value = (stage->op == OP_STR) ? cpu->phys_regs[rs3_physical] : cpu->phys_regs[rs2_physical];
+				iq_entry->src2_tag = (stage->op == OP_STR) ? rs3_physical : rs2_physical;
+				iq_entry->src1_tag = (stage->op == OP_STR || stage->op == OP_STORE || vector_store) ? rs2_physical : ((stage->op == OP_BZ || stage->op == OP_BNZ) ? thread->latest_arithmetic_inst_phys_reg : rs1_physical);
+				int src2_ready = (stage->op == OP_STR) ? cpu->phys_regs_valid[rs3_physical] : cpu->phys_regs_valid[rs2_physical];
+				int src1_ready = (stage->op == OP_STR || stage->op == OP_STORE || vector_store) ? cpu->phys_regs_valid[rs2_physical] : ((stage->op == OP_BZ || stage->op == OP_BNZ) ? cpu->phys_regs_valid[thread->latest_arithmetic_inst_phys_reg] : cpu->phys_regs_valid[rs1_physical]);
 				iq_entry->lsq_index = cpu->lsq_tail;
 				iq_entry->literal = stage->imm;
-				iq_entry->bis_index = cpu->bis_tail;
+				iq_entry->bis_index = branch_tag(thread);
 				iq_entry->des_physical_reg = first_free_phy_reg;
-				iq_entry->rob_index = cpu->rob_tail;
+				iq_entry->rob_index = thread->rob_tail;
 				iq_entry->stage_finished = DRF;
 				iq_entry->pc_value = stage->pc;
-				if (strcmp(stage->opcode, "MUL") == 0) {
-					iq_entry->fu_type_needed = MUL;
-				} else if (strcmp(stage->opcode, "BZ") == 0 || strcmp(stage->opcode, "BNZ") == 0) {
-					iq_entry->fu_type_needed = BRANCH;
-					// Checkpointing here
-					//1. Check which checkpoint rename table is free
-					//2. Copy contents of the rename table to the checkpoint rename table
-					//3. Copy contents of free list to the checkppoint free list table
-					int i;
-					if(cpu->checkpoint1_free == 1) {
-						bis_entry->checkpoint_entry = 1;
-						for(i = 0; i < ARF_SIZE; i++) {
-							cpu->checkpoint_rename_table_1[i] = cpu->rename_table[i];
-						}
-						for(i = 0; i < PRF_SIZE; i++) {
-							cpu->free_PR_list_checkpoint_1[i] = cpu->free_PR_list[i];
-						}
-					} else {
-						bis_entry->checkpoint_entry = 2;
-						for(i = 0; i < ARF_SIZE; i++) {
-							cpu->checkpoint_rename_table_2[i] = cpu->rename_table[i];
-						}
-						for(i = 0; i < PRF_SIZE; i++) {
-							cpu->free_PR_list_checkpoint_2[i] = cpu->free_PR_list[i];
-						}
-					}
-				} else if(strcmp(stage->opcode, "JUMP") == 0) {
-					iq_entry->fu_type_needed = BRANCH;
+				iq_entry->seq = stage->seq;
+				iq_entry->thread = cpu->front_end_thread;
+				iq_entry->fused = fused;
+				if (stage->op == OP_BZ || stage->op == OP_BNZ) {
+					checkpoint_rename_state(cpu, thread, bis_entry);
+				} else if(stage->op == OP_JUMP) {
 					stage->stalled = 1;
-					(&cpu->stage[F])->stalled = 1;
-
-				} else {
-					iq_entry->fu_type_needed = INT;
+					thread->jump_pending = 1;
 				}
-				if(strcmp("ADD", stage->opcode) == 0 || strcmp("SUB", stage->opcode) == 0 || strcmp("ADDL", stage->opcode) == 0 || strcmp("SUBL", stage->opcode) == 0 || strcmp("MUL", stage->opcode) == 0) {
-					cpu->latest_arithmetic_inst_phys_reg = first_free_phy_reg;
+				apply_timing(cpu, iq_entry, stage->op);
+				iq_insert(cpu, iq_index, src1_ready, src2_ready);
+				if(stage->op == OP_ADD || stage->op == OP_SUB || stage->op == OP_ADDL || stage->op == OP_SUBL || stage->op == OP_MUL) {
+					move_register_ref(cpu, cpu->checkpoint_refs, &thread->latest_arithmetic_inst_phys_reg, first_free_phy_reg);
 				}
-				if(previous_phy_reg > -1 && cpu->consumers[previous_phy_reg] <= 0) {
-					cpu->free_PR_list[previous_phy_reg] = 1;
+				release_register(cpu, previous_phy_reg);
+				for (i = 0; i < rob_entry->lanes; i++) {
+					release_register(cpu, lane_previous[i]);
+				}
+				if (fused == FUSED_BZ || fused == FUSED_BNZ) {
+					/* The BZ/BNZ behind is taken along and resolves on this result in INT2 */
+					fused_pc = stage->pc + 4;
+					fused_seq = take_from_front_end(cpu, thread, fused_ins, stage->pc);
+					trace_event(cpu->trace, TRACE_RENAME, fused_seq, fused_pc, cpu->clock);
+					trace_event(cpu->trace, TRACE_DISPATCH, fused_seq, fused_pc, cpu->clock);
+					bis_entry = allocate_branch_tag(thread, fused_pc);
+					checkpoint_rename_state(cpu, thread, bis_entry);
+					cpu->iq_bis_index[iq_index] = iq_entry->bis_index = branch_tag(thread);
+					iq_entry->fused_pc = rob_entry->fused_pc = fused_pc;
+					iq_entry->fused_seq = rob_entry->fused_seq = fused_seq;
+					iq_entry->fused_literal = fused_ins->imm;
+					thread->last_dispatched_seq = fused_seq;
+					cpu->fused_branches += 1;
 				}
 			}
 		}
 		//fprintf(stderr, "Test decode 7\n");
-		current_ins->stage_finished = DRF;
-		if (ENABLE_DEBUG_MESSAGES) {
-			print_stage_content("Instruction at DECODE_RF_STAGE--->\t", stage, (!stage->stalled && current_ins->stage_finished == DRF && (get_code_index(stage->pc) < cpu->code_memory_size)), cpu, iq_entry, DRF);
+		/* A stalled instruction stays in decode to retry; fetch has already moved past it */
+		if (!is_stage_stalled) {
+			current_ins->stage_finished = DRF;
+		}
+		if (LOG_ENABLED(LOG_DECODE, LOG_DEBUG)) {
+			print_stage_content("Instruction at DECODE_RF_STAGE--->\t", stage, (!stage->stalled && current_ins->stage_finished == DRF && (get_code_index(stage->pc) < thread->code_memory_size)), cpu, iq_entry, DRF);
 		}
 		//TODO: Handle tracking of the latest arithmetic instruction for branch instructions.
 		//TODO: Handle flushing and rollback, forwarding, instruction commitment and freeing physical registers
 	}
-	else if (ENABLE_DEBUG_MESSAGES) {
+	else if (LOG_ENABLED(LOG_DECODE, LOG_DEBUG)) {
 		print_stage_content("Instruction at DECODE_RF_STAGE--->\t", stage, 0, cpu, NULL, DRF);
 	}
-	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
-	printf("Details of RENAME TABLE State --\n");
-	for (int i = 0; i < 16; i++) {
-		//To display content of rename table only when PR is assigned to AR.
-		if (cpu->rename_table[i] != -1) {
-			printf("R[%d] -> P[%d]\n", i, cpu->rename_table[i]);
+	if (LOG_ENABLED(LOG_DECODE, LOG_DEBUG)) {
+		log_printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+		log_printf("Details of RENAME TABLE State --\n");
+		for (int i = 0; i < 16; i++) {
+			//To display content of rename table only when PR is assigned to AR.
+			if (thread->rename_table[i] != -1) {
+				log_printf("R[%d] -> P[%d]\n", i, thread->rename_table[i]);
+			}
 		}
-	}
-	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
-	//cpu->stage[IQ] = cpu->stage[DRF];
+		log_printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+		//cpu->stage[IQ] = thread->stage[DRF];
 
-	printf("Details of ARF State –\n");
-	for(int i = 0; i< 16; i++) {
-		if(cpu->regs[i] != -1) {
-			printf("R%d --> %d\n", i, cpu->regs[i]);
+		log_printf("Details of ARF State –\n");
+		for(int i = 0; i< 16; i++) {
+			if(thread->regs[i] != -1) {
+				log_printf("R%d --> %d\n", i, thread->regs[i]);
+			}
 		}
+		log_printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
 	}
-	printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
 	stage->is_empty = 1;
 	return 0;
 }
@@ -653,243 +1807,413 @@ int issue_queue(APEX_CPU *cpu)
 	int mul_fu_issued = -1;
 	int branch_fu_issued = -1;
 
-	IQ_ENTRY selected_int_inst;
-	IQ_ENTRY selected_mul_inst;
-	IQ_ENTRY selected_branch_inst;
-	for (i = 0; i < IQ_SIZE; i++) {
-		if(cpu->iq_free[i] != 0) {
+	uint32_t occupied = cpu->iq_valid;
+	// Needed sources must be ready, the others are ignored
+	uint32_t ready = occupied & (cpu->iq_src1_ready | ~cpu->iq_src1_needed) & (cpu->iq_src2_ready | ~cpu->iq_src2_needed);
+	if (cpu->iq_lanes & occupied) {
+		ready &= ~cpu->iq_lanes | iq_lanes_ready(cpu);
+	}
+	for (; occupied; occupied &= occupied - 1) {
+		i = __builtin_ctz(occupied);
+		APEX_LOG(LOG_ISSUE, LOG_TRACE, "IQ entry %d occupied\n", i);
+		PC_PROFILE* profile = profile_of(&cpu->threads[cpu->iq_thread[i]], cpu->iq_pc[i]);
+		if(profile) {
+			profile->iq_wait_cycles += 1;
+		}
+		if (!(ready & (1u << i))) {
 			continue;
 		}
-		fprintf(stderr, "cpu free %d %d\n", i, cpu->iq_free[i]);
-		IQ_ENTRY iq_entry = cpu->IQ[i];
-		if(strcmp("ADD", iq_entry.opcode) == 0 || strcmp("SUB", iq_entry.opcode) == 0 || strcmp("MUL", iq_entry.opcode) == 0 || strcmp("AND", iq_entry.opcode) == 0 || strcmp("OR", iq_entry.opcode) == 0 || strcmp("EX-OR", iq_entry.opcode) == 0 || strcmp("LDR", iq_entry.opcode) == 0 || strcmp("STR", iq_entry.opcode) == 0) {
-			if (iq_entry.src1_ready == 1 && iq_entry.src2_ready == 1) {
-				if (iq_entry.fu_type_needed == INT && iq_entry.pc_value < selected_inst_pc_value_int) {
-					selected_int_inst = iq_entry;
-					selected_inst_pc_value_int = iq_entry.pc_value;
-					int_fu_issued = i;
-				} else if (iq_entry.fu_type_needed == MUL && iq_entry.pc_value < selected_inst_pc_value_mul) {
-					mul_fu_issued = i;
-					selected_mul_inst = iq_entry;
-					selected_inst_pc_value_mul = iq_entry.pc_value;
-				} else if (iq_entry.fu_type_needed == BRANCH && iq_entry.pc_value < selected_inst_pc_value_branch) {
-					branch_fu_issued = i;
-					selected_branch_inst = iq_entry;
-					selected_inst_pc_value_branch = iq_entry.pc_value;
-				}
-			}
-		} else if(strcmp("ADDL", iq_entry.opcode) == 0 || strcmp("SUBL", iq_entry.opcode) == 0 || strcmp("JUMP", iq_entry.opcode) == 0 || strcmp("LOAD", iq_entry.opcode) == 0 || strcmp("STORE", iq_entry.opcode) == 0 || strcmp("BZ", iq_entry.opcode) == 0 || strcmp("BNZ", iq_entry.opcode) == 0) {
-			if (iq_entry.src1_ready == 1) {
-				if (iq_entry.fu_type_needed == INT && iq_entry.pc_value < selected_inst_pc_value_int) {
-					selected_int_inst = iq_entry;
-					selected_inst_pc_value_int = iq_entry.pc_value;
-					int_fu_issued = i;
-				} else if (iq_entry.fu_type_needed == MUL && iq_entry.pc_value < selected_inst_pc_value_mul) {
-					mul_fu_issued = i;
-					selected_mul_inst = iq_entry;
-					selected_inst_pc_value_mul = iq_entry.pc_value;
-				} else if (iq_entry.fu_type_needed == BRANCH && iq_entry.pc_value < selected_inst_pc_value_branch) {
-					branch_fu_issued = i;
-					selected_branch_inst = iq_entry;
-					selected_inst_pc_value_branch = iq_entry.pc_value;
-				}
-			}
-		} else {
-			if (iq_entry.fu_type_needed == INT && iq_entry.pc_value < selected_inst_pc_value_int) {
-				selected_int_inst = iq_entry;
-				selected_inst_pc_value_int = iq_entry.pc_value;
-				int_fu_issued = i;
-			} else if (iq_entry.fu_type_needed == MUL && iq_entry.pc_value < selected_inst_pc_value_mul) {
-				mul_fu_issued = i;
-				selected_mul_inst = iq_entry;
-				selected_inst_pc_value_mul = iq_entry.pc_value;
-			} else if (iq_entry.fu_type_needed == BRANCH && iq_entry.pc_value < selected_inst_pc_value_branch) {
-				branch_fu_issued = i;
-				selected_branch_inst = iq_entry;
-				selected_inst_pc_value_branch = iq_entry.pc_value;
-			}
+		int pc_value = cpu->iq_pc[i];
+		// A unit still inside the issue interval of its last instruction takes nothing
+		if (cpu->iq_fu_type[i] == INT && pc_value < selected_inst_pc_value_int && cpu->clock >= cpu->unit_next_issue[UNIT_INT]) {
+			selected_inst_pc_value_int = pc_value;
+			int_fu_issued = i;
+		} else if (cpu->iq_fu_type[i] == MUL && pc_value < selected_inst_pc_value_mul && cpu->clock >= cpu->unit_next_issue[UNIT_MUL]) {
+			mul_fu_issued = i;
+			selected_inst_pc_value_mul = pc_value;
+		} else if (cpu->iq_fu_type[i] == BRANCH && pc_value < selected_inst_pc_value_branch && cpu->clock >= cpu->unit_next_issue[UNIT_BRANCH]) {
+			branch_fu_issued = i;
+			selected_inst_pc_value_branch = pc_value;
 		}
 	}
-	if(ENABLE_DEBUG_MESSAGES) {
-		printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
-		printf("Details of IQ (Issue Queue) State –\n");
+	if(LOG_ENABLED(LOG_ISSUE, LOG_DEBUG)) {
+		log_printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+		log_printf("Details of IQ (Issue Queue) State –\n");
 		IQ_ENTRY* iq_entry_1;
 		for(i = 0; i < IQ_SIZE; i++) {
-			if(cpu->iq_free[i] == 0) {
-				fprintf(stderr, "IQ[0%d] --> ", i);
+			if(cpu->iq_valid & (1u << i)) {
 				iq_entry_1 = &cpu->IQ[i];
-				printf("IQ[0%d] --> ",i);
+				log_printf("IQ[0%d] --> ",i);
 				print_stage_content("", NULL, 1, cpu, iq_entry_1, IQ);
 			}
 		}
-		printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+		log_printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
 
-		printf("Details of LSQ (Load-Store Queue) State –\n");
+		log_printf("Details of LSQ (Load-Store Queue) State –\n");
 		LSQ_ENTRY* lsq_entry;
 		int j = 0;
 		if(cpu->lsq_current_size > 0) {
 			int counter = cpu->lsq_current_size;
 			for(j = cpu->lsq_head; counter > 0 ; j = (j+1)%LSQ_SIZE) {
 				lsq_entry = &cpu->LSQ[j];
-				printf("LSQ[0%d] --> ",j);
+				log_printf("LSQ[0%d] --> ",j);
 				print_lsq(cpu, lsq_entry);
-				printf("\n");
+				log_printf("\n");
 				counter -= 1;
 			}
 		}
-		printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+		log_printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
 
-		printf("Details of ROB (Reorder Buffer) State –\n");
+		log_printf("Details of ROB (Reorder Buffer) State –\n");
 		ROB_ENTRY* rob_entry;
-		if(cpu->rob_current_size > 0) {
-			int counter = cpu->rob_current_size;
-			for(j = cpu->rob_head; counter > 0 ; j = (j+1)%ROB_SIZE) {
-				rob_entry = &cpu->ROB[j];
-				printf("ROB[0%d] --> ",j);
-				print_rob(cpu, rob_entry->pc_value);
-				printf("\n");
-				counter -= 1;
+		for(int t = 0; t < cpu->num_threads; t++) {
+			APEX_THREAD* thread = &cpu->threads[t];
+			if(thread->rob_current_size > 0) {
+				int counter = thread->rob_current_size;
+				for(j = thread->rob_head; counter > 0 ; j = (j+1)%ROB_SIZE) {
+					rob_entry = &thread->ROB[j];
+					if(cpu->num_threads > 1) {
+						log_printf("T%d ", t);
+					}
+					log_printf("ROB[0%d] --> ",j);
+					print_rob(thread, rob_entry->pc_value);
+					log_printf("\n");
+					counter -= 1;
+				}
 			}
 		}
-		printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+		log_printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
 	}
 	if(int_fu_issued > -1) {
-		IQ_ENTRY entry = selected_int_inst;
-		(&cpu->stage[INT1])->iq_entry = entry;
-		(cpu->stage[INT1]).iq_entry.stage_finished = IQ;
-		(cpu->stage[INT1]).busy = 0;
-		(cpu->stage[INT1]).stalled = 0;
-		cpu->iq_free[int_fu_issued] = 1;
+		IQ_ENTRY selected_int_inst = cpu->IQ[int_fu_issued];
+		CPU_Stage* int_stage = latch_fill(&cpu->latch[INT1]);
+		int_stage->iq_entry = selected_int_inst;
+		int_stage->iq_entry.stage_finished = IQ;
+		int_stage->busy = 0;
+		int_stage->stalled = 0;
+		iq_issued(cpu, int_fu_issued);
+		cpu->unit_next_issue[UNIT_INT] = cpu->clock + selected_int_inst.issue_interval;
+		trace_event(cpu->trace, TRACE_ISSUE, selected_int_inst.seq, selected_int_inst.pc_value, cpu->clock);
+		if(selected_int_inst.fused == FUSED_BZ || selected_int_inst.fused == FUSED_BNZ) {
+			trace_event(cpu->trace, TRACE_ISSUE, selected_int_inst.fused_seq, selected_int_inst.fused_pc, cpu->clock);
+		}
+		PC_PROFILE* profile = profile_of(&cpu->threads[selected_int_inst.thread], selected_int_inst.pc_value);
+		if(profile) {
+			profile->executions += 1;
+		}
 	}
 	if(mul_fu_issued > -1) {
-		(&cpu->stage[MUL1])->iq_entry = (selected_mul_inst);
-		(&cpu->stage[MUL1])->iq_entry.stage_finished = IQ;
-		(&cpu->stage[MUL1])->busy = 0;
-		(&cpu->stage[MUL1])->stalled = 0;
-		cpu->iq_free[mul_fu_issued] = 1;
+		IQ_ENTRY selected_mul_inst = cpu->IQ[mul_fu_issued];
+		CPU_Stage* mul_stage = latch_fill(&cpu->latch[MUL1]);
+		mul_stage->iq_entry = selected_mul_inst;
+		mul_stage->iq_entry.stage_finished = IQ;
+		mul_stage->busy = 0;
+		mul_stage->stalled = 0;
+		iq_issued(cpu, mul_fu_issued);
+		cpu->unit_next_issue[UNIT_MUL] = cpu->clock + selected_mul_inst.issue_interval;
+		trace_event(cpu->trace, TRACE_ISSUE, selected_mul_inst.seq, selected_mul_inst.pc_value, cpu->clock);
+		PC_PROFILE* profile = profile_of(&cpu->threads[selected_mul_inst.thread], selected_mul_inst.pc_value);
+		if(profile) {
+			profile->executions += 1;
+		}
 	}
 	if(branch_fu_issued > -1) {
-		(&cpu->stage[BRANCH])->iq_entry = (selected_branch_inst);
-		(&cpu->stage[BRANCH])->iq_entry.stage_finished = IQ;
-		(&cpu->stage[BRANCH])->busy = 0;
-		(&cpu->stage[BRANCH])->stalled = 0;
-		cpu->iq_free[branch_fu_issued] = 1;
+		IQ_ENTRY selected_branch_inst = cpu->IQ[branch_fu_issued];
+		CPU_Stage* branch_stage = latch_fill(&cpu->latch[BRANCH]);
+		branch_stage->iq_entry = selected_branch_inst;
+		branch_stage->iq_entry.stage_finished = IQ;
+		branch_stage->busy = 0;
+		branch_stage->stalled = 0;
+		iq_issued(cpu, branch_fu_issued);
+		cpu->unit_next_issue[UNIT_BRANCH] = cpu->clock + selected_branch_inst.issue_interval;
+		trace_event(cpu->trace, TRACE_ISSUE, selected_branch_inst.seq, selected_branch_inst.pc_value, cpu->clock);
+		PC_PROFILE* profile = profile_of(&cpu->threads[selected_branch_inst.thread], selected_branch_inst.pc_value);
+		if(profile) {
+			profile->executions += 1;
+		}
 	}
 
 	return 0;
 }
 
-int int_fu_1(APEX_CPU *cpu)
+/*
+ * Has thread flushed back to target_address at the end of the cycle. A
+ * fused branch resolving in INT2 can mispredict in the same cycle as the
+ * branch unit; only the older of the two is recovered from.
+ */
+static void
+request_flush(APEX_THREAD *thread, BTB_ENTRY *btb_entry, IQ_ENTRY *iq_entry, int target_address)
 {
-	CPU_Stage *stage = &cpu->stage[INT1];
+	if (thread->flush_and_reload && thread->mispredicted_branch_iq_entry->seq < iq_entry->seq) {
+		return;
+	}
+	thread->mispredicted_branch_btb_entry = btb_entry;
+	thread->mispredicted_branch_iq_entry = iq_entry;
+	thread->mispredicted_branch_target_address_new = target_address;
+	thread->flush_and_reload = 1;
+	thread->stop_fetch_decode = 0;
+}
+
+/*
+ * Checks the BZ (is_bz) or BNZ at pc, whose zero flag input is flag,
+ * against the BTB prediction, flushing on a mispredict, and trains its
+ * BTB entry. iq_entry is the branch or the op it is fused into.
+ */
+static void
+resolve_conditional_branch(APEX_CPU *cpu, APEX_THREAD *thread, IQ_ENTRY *iq_entry, int is_bz, int pc, int target, int flag)
+{
+	BTB_ENTRY* btb_entry;
+	int i;
+	for(i = 0; i < BTB_SIZE; i++) {
+		btb_entry = (&thread->BTB[i]);
+		if(btb_entry->branch_ins_pc_value == pc) {
+			btb_entry->target_pc_value = target;
+			break;
+		}
+	}
+	if((is_bz && ((flag == 1 && btb_entry->history_bit == 0) || (flag == 0 && btb_entry->history_bit == 1)))
+	   || (!is_bz && ((flag == 0 && btb_entry->history_bit == 0) || (flag == 1 && btb_entry->history_bit == 1)))) {
+		//flush and go to target address
+		int target_pc_value;
+		if(btb_entry->history_bit == 0) {
+			target_pc_value = btb_entry->target_pc_value;
+		} else {
+			target_pc_value = btb_entry->branch_ins_pc_value  + 4;
+		}
+		request_flush(thread, btb_entry, iq_entry, target_pc_value);
+		PC_PROFILE* profile = profile_of(thread, pc);
+		if(profile) {
+			profile->mispredicts += 1;
+		}
+		cpu->branch_mispredicts += 1;
+	}
+	if(is_bz) {
+		btb_entry->history_bit = flag == 1 ? 1 : 0;
+	} else {
+		btb_entry->history_bit = flag == 0 ? 1 : 0;
+	}
+}
+
+/*
+ * An instruction whose latency is longer than the stages of its unit
+ * leaves the last stage for the parked buffer and completes there
+ * extra_latency cycles later, so the unit keeps taking instructions
+ * behind it. Returns 1 if the instruction in stage was parked.
+ */
+static int
+park_for_latency(APEX_CPU *cpu, CPU_Stage *stage, int last_stage)
+{
+	if (stage->iq_entry.extra_latency == 0) {
+		return 0;
+	}
+	int slot = __builtin_ctzll(~cpu->parked_valid);
+	cpu->parked[slot] = *stage;
+	cpu->parked_ready[slot] = cpu->clock + stage->iq_entry.extra_latency;
+	cpu->parked_stage[slot] = last_stage;
+	cpu->parked_valid |= 1ull << slot;
+	stage->iq_entry.stage_finished = last_stage;
+	return 1;
+}
+
+/* Completes the instructions parked behind last_stage whose result is due this cycle */
+static void
+complete_parked(APEX_CPU *cpu, int last_stage, void (*complete)(APEX_CPU *, CPU_Stage *))
+{
+	for (uint64_t parked = cpu->parked_valid; parked; parked &= parked - 1) {
+		int slot = __builtin_ctzll(parked);
+		if (cpu->parked_stage[slot] == last_stage && cpu->parked_ready[slot] <= cpu->clock) {
+			cpu->parked_valid &= ~(1ull << slot);
+			complete(cpu, &cpu->parked[slot]);
+		}
+	}
+}
+
+/*
+ * First stage work of INT and MUL: the result or memory address of the
+ * instruction in stage. Both units run every ALU opcode and MUL, for
+ * machine descriptions that move opcodes between them. Vector opcodes
+ * read their lanes from the PRF here, held there by their consumers.
+ */
+static void
+execute_alu(APEX_CPU *cpu, CPU_Stage *stage, IQ_ENTRY *iq_entry)
+{
+	if (iq_entry->lanes) {
+		int src1[VLEN];
+		int src2[VLEN];
+		for (int lane = 0; lane < VLEN; lane++) {
+			src1[lane] = lane_value(cpu, iq_entry->lane_src1_tags[lane]);
+			src2[lane] = lane_value(cpu, iq_entry->lane_src2_tags[lane]);
+		}
+		simd_execute(vector_alu_op(iq_entry->op), src1, src2, stage->lane_buffer);
+	} else if(iq_entry->op == OP_MOVC) {
+		stage->buffer = iq_entry->literal;
+	} else if (iq_entry->op == OP_ADD) {
+		stage->buffer = iq_entry->src1_value + iq_entry->src2_value;
+	} else if (iq_entry->op == OP_ADDL) {
+		stage->buffer = iq_entry->src1_value + iq_entry->literal;
+	} else if (iq_entry->op == OP_SUB) {
+		stage->buffer = iq_entry->src1_value - iq_entry->src2_value;
+	} else if (iq_entry->op == OP_SUBL) {
+		stage->buffer = iq_entry->src1_value - iq_entry->literal;
+	} else if (iq_entry->op == OP_AND) {
+		stage->buffer = iq_entry->src1_value & iq_entry->src2_value;
+	} else if (iq_entry->op == OP_OR) {
+		stage->buffer = iq_entry->src1_value | iq_entry->src2_value;
+	} else if (iq_entry->op == OP_EXOR) {
+		stage->buffer = iq_entry->src1_value ^ iq_entry->src2_value;
+	} else if (iq_entry->op == OP_MUL) {
+		stage->buffer = iq_entry->src1_value * iq_entry->src2_value;
+	} else if (iq_entry->op == OP_LOAD || iq_entry->op == OP_VLOAD) {
+		stage->mem_address = iq_entry->src1_value + iq_entry->literal;
+	} else if (iq_entry->op == OP_LDR) {
+		stage->mem_address = iq_entry->src1_value + iq_entry->src2_value;;
+	} else if (iq_entry->op == OP_STORE || iq_entry->op == OP_VSTORE) {
+		stage->mem_address = iq_entry->src1_value + iq_entry->literal;
+	} else if (iq_entry->op == OP_STR) {
+		stage->mem_address = iq_entry->src1_value + iq_entry->src2_value;;
+	}
+}
+
+int int_fu_1(APEX_CPU *cpu)
+{
+	CPU_Stage *stage = cpu->latch[INT1].cur;
 	IQ_ENTRY* iq_entry = &stage->iq_entry;
 	if (iq_entry && !stage->busy && !stage->stalled && iq_entry->stage_finished < INT1)
 	{
-		if(strcmp(iq_entry->opcode,"MOVC") == 0) {
-			stage->buffer = iq_entry->literal;
-		} else if (strcmp(iq_entry->opcode, "ADD") == 0) {
-			stage->buffer = iq_entry->src1_value + iq_entry->src2_value;
-		} else if (strcmp(iq_entry->opcode, "ADDL") == 0) {
-			stage->buffer = iq_entry->src1_value + iq_entry->literal;
-		} else if (strcmp(iq_entry->opcode, "SUB") == 0) {
-			stage->buffer = iq_entry->src1_value - iq_entry->src2_value;
-		} else if (strcmp(iq_entry->opcode, "SUBL") == 0) {
-			stage->buffer = iq_entry->src1_value - iq_entry->literal;
-		} else if (strcmp(iq_entry->opcode, "AND") == 0) {
-			stage->buffer = iq_entry->src1_value & iq_entry->src2_value;
-		} else if (strcmp(iq_entry->opcode, "OR") == 0) {
-			stage->buffer = iq_entry->src1_value | iq_entry->src2_value;
-		} else if (strcmp(iq_entry->opcode, "EX-OR") == 0) {
-			stage->buffer = iq_entry->src1_value ^ iq_entry->src2_value;
-		} else if (strcmp(iq_entry->opcode, "LOAD") == 0) {
-			stage->mem_address = iq_entry->src1_value + iq_entry->literal;
-		} else if (strcmp(iq_entry->opcode, "LDR") == 0) {
-			stage->mem_address = iq_entry->src1_value + iq_entry->src2_value;;
-		} else if (strcmp(iq_entry->opcode, "STORE") == 0) {
-			stage->mem_address = iq_entry->src1_value + iq_entry->literal;
-		} else if (strcmp(iq_entry->opcode, "STR") == 0) {
-			stage->mem_address = iq_entry->src1_value + iq_entry->src2_value;;
-		}
+		execute_alu(cpu, stage, iq_entry);
 		iq_entry->stage_finished = INT1;
-		cpu->stage[INT2] = cpu->stage[INT1];
-		if (ENABLE_DEBUG_MESSAGES) {
+		latch_pass(&cpu->latch[INT1], &cpu->latch[INT2]);
+		if (LOG_ENABLED(LOG_EXEC, LOG_DEBUG)) {
 			print_stage_content("Instruction at INT1_FU_STAGE--->", stage, iq_entry->stage_finished == INT1, cpu, iq_entry, INT1);
 		}
 	}
-	else if (ENABLE_DEBUG_MESSAGES) {
+	else if (LOG_ENABLED(LOG_EXEC, LOG_DEBUG)) {
 		print_stage_content("Instruction at INT1_FU_STAGE--->", stage, 0, cpu, iq_entry, INT1);
 	}
 	return 0;
 }
 
-int int_fu_2(APEX_CPU *cpu)
+/*
+ * Writes the lane values of the vector instruction in rob_entry to its
+ * lane registers, forwarding each to the IQ and to stores in the LSQ.
+ */
+static void
+write_lanes(APEX_CPU *cpu, ROB_ENTRY *rob_entry, const int *values)
 {
-	CPU_Stage *stage = &cpu->stage[INT2];
-	IQ_ENTRY* iq_entry = &stage->iq_entry;
-	if (iq_entry && !stage->busy && !stage->stalled && iq_entry->stage_finished < INT2)
-	{
-		if(strcmp(iq_entry->opcode, "STR") == 0 || strcmp(iq_entry->opcode, "STORE") == 0 || strcmp(iq_entry->opcode, "LOAD") == 0 || strcmp(iq_entry->opcode, "LDR") == 0) {
-			cpu->stage[WLSQ] = cpu->stage[INT2];
-		} else if (strcmp(iq_entry->opcode, "ADD") == 0 || strcmp(iq_entry->opcode, "ADDL") == 0 || strcmp(iq_entry->opcode, "SUB") == 0 || strcmp(iq_entry->opcode, "SUBL") == 0 || strcmp(iq_entry->opcode, "MOVC") == 0 || strcmp(iq_entry->opcode, "AND") == 0 || strcmp(iq_entry->opcode, "OR") == 0 || strcmp(iq_entry->opcode, "EX-OR") == 0){
-			ROB_ENTRY *rob_entry = &cpu->ROB[iq_entry->rob_index];	
-			rob_entry->exception_codes = 0;
-			rob_entry->result_valid = 1;
-			rob_entry->result = stage->buffer;
-			cpu->phys_regs[iq_entry->des_physical_reg] = stage->buffer;
-			cpu->phys_regs_valid[iq_entry->des_physical_reg] = 1;
-			if (strcmp(stage->opcode, "ADD") == 0 || strcmp(stage->opcode, "ADDL") == 0 || strcmp(stage->opcode, "SUB") == 0 || strcmp(stage->opcode, "SUBL") == 0) {
-				cpu->flag_condition[iq_entry->des_physical_reg] = (stage->buffer == 0);
-			}
-			int i;
-			for (i = 0; i < IQ_SIZE; i++) {
-				IQ_ENTRY *test_iq_entry = &cpu->IQ[i];
-				if (cpu->iq_free[i] == 0) {
-					if (iq_entry->des_physical_reg == test_iq_entry->src1_tag) {
-						if(strcmp(test_iq_entry->opcode, "BZ") == 0 || strcmp(test_iq_entry->opcode, "BNZ") == 0) {
-							test_iq_entry->src1_value = (stage->buffer == 0);
-						} else {
-							test_iq_entry->src1_value = stage->buffer;
-						}
-						test_iq_entry->src1_ready = 1;
-					}
-					if (iq_entry->des_physical_reg == test_iq_entry->src2_tag) {
-						test_iq_entry->src2_value = stage->buffer;
-						test_iq_entry->src2_ready = 1;
-					}
-				}
+	for (int lane = 0; lane < VLEN; lane++) {
+		int phys_reg = rob_entry->lane_phys_registers[lane];
+		rob_entry->lane_results[lane] = values[lane];
+		cpu->phys_regs[phys_reg] = values[lane];
+		cpu->phys_regs_valid[phys_reg] = 1;
+		iq_wakeup(cpu, phys_reg, values[lane], 0);
+		int counter = cpu->lsq_current_size;
+		for (int i = cpu->lsq_head; counter > 0; i = (i + 1) % LSQ_SIZE) {
+			LSQ_ENTRY* lsq_entry = &cpu->LSQ[i];
+			if (lsq_entry->src1_tag == phys_reg && lsq_entry->src1_valid != 1) {
+				lsq_entry->src1_valid = 1;
+				lsq_entry->value = values[lane];
 			}
-			//Forward to LSQ entries
-			if(cpu->lsq_current_size > 0) {
-				int counter = cpu->lsq_current_size;
-				for(i = cpu->lsq_head; counter > 0; i = (i+1)%LSQ_SIZE) {
-					LSQ_ENTRY* lsq_entry = &(cpu->LSQ[i]);
-					if(lsq_entry->src1_tag == iq_entry->des_physical_reg) {
-						lsq_entry->src1_valid = 1;
-						lsq_entry->value = stage->buffer;
-					}
-					counter -= 1;
+			counter -= 1;
+		}
+	}
+	rob_entry->result = values[0];
+}
+
+/* Writes back the lanes of the VADD/VSUB/VMUL/VAND in stage, on INT or MUL */
+static void
+complete_lanes(APEX_CPU *cpu, CPU_Stage *stage)
+{
+	IQ_ENTRY* iq_entry = &stage->iq_entry;
+	APEX_THREAD* thread = &cpu->threads[iq_entry->thread];
+	ROB_ENTRY *rob_entry = &thread->ROB[iq_entry->rob_index];
+	rob_entry->exception_codes = 0;
+	thread->rob_done |= 1u << iq_entry->rob_index;
+	trace_event(cpu->trace, TRACE_COMPLETE, iq_entry->seq, iq_entry->pc_value, cpu->clock);
+	write_lanes(cpu, rob_entry, stage->lane_buffer);
+	for (int lane = 0; lane < VLEN; lane++) {
+		if (iq_entry->lane_src1_tags[lane] > -1) {
+			drop_consumer(cpu, iq_entry->lane_src1_tags[lane]);
+		}
+		if (iq_entry->lane_src2_tags[lane] > -1) {
+			drop_consumer(cpu, iq_entry->lane_src2_tags[lane]);
+		}
+	}
+}
+
+/* Writes back the result of the INT instruction in stage, or hands a memory instruction to the LSQ */
+static void
+complete_int(APEX_CPU *cpu, CPU_Stage *stage)
+{
+	IQ_ENTRY* iq_entry = &stage->iq_entry;
+	APEX_THREAD* thread = &cpu->threads[iq_entry->thread];
+	if(iq_entry->op == OP_STR || iq_entry->op == OP_STORE || iq_entry->op == OP_LOAD || iq_entry->op == OP_LDR
+	   || iq_entry->op == OP_VLOAD || iq_entry->op == OP_VSTORE) {
+		latch_pass(&cpu->latch[INT2], &cpu->latch[WLSQ]);
+	} else if (iq_entry->lanes) {
+		complete_lanes(cpu, stage);
+	} else if (iq_entry->op == OP_ADD || iq_entry->op == OP_ADDL || iq_entry->op == OP_SUB || iq_entry->op == OP_SUBL || iq_entry->op == OP_MOVC || iq_entry->op == OP_AND || iq_entry->op == OP_OR || iq_entry->op == OP_EXOR || iq_entry->op == OP_MUL){
+		ROB_ENTRY *rob_entry = &thread->ROB[iq_entry->rob_index];	
+		rob_entry->exception_codes = 0;
+		thread->rob_done |= 1u << iq_entry->rob_index;
+		rob_entry->result = stage->buffer;
+		trace_event(cpu->trace, TRACE_COMPLETE, iq_entry->seq, iq_entry->pc_value, cpu->clock);
+		cpu->phys_regs[iq_entry->des_physical_reg] = stage->buffer;
+		cpu->phys_regs_valid[iq_entry->des_physical_reg] = 1;
+		if (iq_entry->op == OP_ADD || iq_entry->op == OP_ADDL || iq_entry->op == OP_SUB || iq_entry->op == OP_SUBL || iq_entry->op == OP_MUL) {
+			cpu->flag_condition[iq_entry->des_physical_reg] = (stage->buffer == 0);
+		}
+		int i;
+		iq_wakeup(cpu, iq_entry->des_physical_reg, stage->buffer, 1);
+		if (iq_entry->fused == FUSED_BZ || iq_entry->fused == FUSED_BNZ) {
+			trace_event(cpu->trace, TRACE_COMPLETE, iq_entry->fused_seq, iq_entry->fused_pc, cpu->clock);
+			resolve_conditional_branch(cpu, thread, iq_entry, iq_entry->fused == FUSED_BZ, iq_entry->fused_pc,
+						   iq_entry->fused_pc + iq_entry->fused_literal, stage->buffer == 0);
+		}
+		//Forward to LSQ entries
+		if(cpu->lsq_current_size > 0) {
+			int counter = cpu->lsq_current_size;
+			for(i = cpu->lsq_head; counter > 0; i = (i+1)%LSQ_SIZE) {
+				LSQ_ENTRY* lsq_entry = &(cpu->LSQ[i]);
+				if(lsq_entry->src1_tag == iq_entry->des_physical_reg && lsq_entry->src1_valid != 1) {
+					lsq_entry->src1_valid = 1;
+					lsq_entry->value = stage->buffer;
 				}
+				counter -= 1;
 			}
 		}
-		if (strcmp(stage->opcode, "ADD") == 0 || strcmp(stage->opcode, "SUB") == 0 || strcmp(stage->opcode, "AND") == 0 || strcmp(stage->opcode, "OR") == 0 || strcmp(stage->opcode, "EX-OR") == 0 || strcmp(stage->opcode, "LDR") == 0 || strcmp(stage->opcode, "STR") == 0) {
-			cpu->consumers[iq_entry->src1_tag] -= 1;
-			cpu->consumers[iq_entry->src2_tag] -= 1;
-		} else if (strcmp(stage->opcode, "ADDL") == 0 || strcmp(stage->opcode, "SUBL") == 0 || strcmp(stage->opcode, "LOAD") == 0 || strcmp(stage->opcode, "STORE") == 0) {
-			cpu->consumers[iq_entry->src1_tag] -= 1;
+	}
+	if (iq_entry->op == OP_ADD || iq_entry->op == OP_SUB || iq_entry->op == OP_AND || iq_entry->op == OP_OR || iq_entry->op == OP_EXOR || iq_entry->op == OP_MUL || iq_entry->op == OP_LDR || iq_entry->op == OP_STR) {
+		drop_consumer(cpu, iq_entry->src1_tag);
+		drop_consumer(cpu, iq_entry->src2_tag);
+	} else if (iq_entry->op == OP_ADDL || iq_entry->op == OP_SUBL || iq_entry->op == OP_LOAD || iq_entry->op == OP_STORE
+		   || iq_entry->op == OP_VLOAD || iq_entry->op == OP_VSTORE) {
+		drop_consumer(cpu, iq_entry->src1_tag);
+	}
+	iq_entry->stage_finished = INT2;
+}
+
+int int_fu_2(APEX_CPU *cpu)
+{
+	complete_parked(cpu, INT2, complete_int);
+	CPU_Stage *stage = cpu->latch[INT2].cur;
+	IQ_ENTRY* iq_entry = &stage->iq_entry;
+	if (iq_entry && !stage->busy && !stage->stalled && iq_entry->stage_finished < INT2 && !cancelled_issue(cpu, stage))
+	{
+		if (!park_for_latency(cpu, stage, INT2)) {
+			complete_int(cpu, stage);
 		}
-		iq_entry->stage_finished = INT2;
-		if (ENABLE_DEBUG_MESSAGES) {
+		if (LOG_ENABLED(LOG_EXEC, LOG_DEBUG)) {
 			print_stage_content("Instruction at INT2_FU_STAGE--->", stage, iq_entry->stage_finished == INT2, cpu, iq_entry, INT2);
 		}
 	}
-	else if (ENABLE_DEBUG_MESSAGES) {
+	else if (LOG_ENABLED(LOG_EXEC, LOG_DEBUG)) {
 		print_stage_content("Instruction at INT2_FU_STAGE--->", stage, 0, cpu, iq_entry, INT2);
 	}
 	return 0;
 }
 
 int writeToLSQ(APEX_CPU *cpu) {
-	CPU_Stage *stage = &cpu->stage[WLSQ];
+	CPU_Stage *stage = cpu->latch[WLSQ].cur;
 	IQ_ENTRY* iq_entry = &stage->iq_entry;
 	if(iq_entry && !stage->busy && !stage->stalled && iq_entry->stage_finished < WLSQ) {
 		(&cpu->LSQ[iq_entry->lsq_index])->calculated_mem_address = stage->mem_address;
@@ -901,19 +2225,17 @@ int writeToLSQ(APEX_CPU *cpu) {
 
 int mul_fu_1(APEX_CPU *cpu)
 {
-	CPU_Stage *stage = &cpu->stage[MUL1];
+	CPU_Stage *stage = cpu->latch[MUL1].cur;
 	IQ_ENTRY* iq_entry = &stage->iq_entry;
 	if (iq_entry && !stage->busy && !stage->stalled && iq_entry->stage_finished < MUL1) {
-		if (strcmp(iq_entry->opcode, "MUL") == 0) {
-				stage->buffer = iq_entry->src1_value * iq_entry->src2_value;
-		}
+		execute_alu(cpu, stage, iq_entry);
 		iq_entry->stage_finished = MUL1;
-		cpu->stage[MUL2] = cpu->stage[MUL1];
-		if (ENABLE_DEBUG_MESSAGES) {
+		latch_pass(&cpu->latch[MUL1], &cpu->latch[MUL2]);
+		if (LOG_ENABLED(LOG_EXEC, LOG_DEBUG)) {
 			print_stage_content("Instruction at MUL1_FU_STAGE--->", stage, iq_entry->stage_finished == MUL1, cpu, iq_entry, MUL1);
 		}
 	}
-	else if (ENABLE_DEBUG_MESSAGES) {
+	else if (LOG_ENABLED(LOG_EXEC, LOG_DEBUG)) {
 		print_stage_content("Instruction at MUL1_FU_STAGE--->", stage, 0, cpu, iq_entry, MUL1);
 	}
 	return 0;
@@ -921,195 +2243,472 @@ int mul_fu_1(APEX_CPU *cpu)
 
 int mul_fu_2(APEX_CPU *cpu)
 {
-	CPU_Stage *stage = &cpu->stage[MUL2];
+	CPU_Stage *stage = cpu->latch[MUL2].cur;
 	IQ_ENTRY* iq_entry = &stage->iq_entry;
-	if (iq_entry && !stage->busy && !stage->stalled && iq_entry->stage_finished < MUL2) {
+	if (iq_entry && !stage->busy && !stage->stalled && iq_entry->stage_finished < MUL2 && !cancelled_issue(cpu, stage)) {
 		iq_entry->stage_finished = MUL2;
-		cpu->stage[MUL3] = cpu->stage[MUL2];
-		if (ENABLE_DEBUG_MESSAGES) {
+		latch_pass(&cpu->latch[MUL2], &cpu->latch[MUL3]);
+		if (LOG_ENABLED(LOG_EXEC, LOG_DEBUG)) {
 			print_stage_content("Instruction at MUL2_FU_STAGE--->", stage, iq_entry->stage_finished == MUL2, cpu, iq_entry, MUL2);
 		}
 	}
-	else if (ENABLE_DEBUG_MESSAGES) {
+	else if (LOG_ENABLED(LOG_EXEC, LOG_DEBUG)) {
 		print_stage_content("Instruction at MUL2_FU_STAGE--->", stage, 0, cpu, iq_entry, MUL2);
 	}
 	return 0;
 }
 
+/*
+ * Writes back the result of the MUL unit instruction in stage. ALU
+ * opcodes a machine description moves here set the zero flag and feed
+ * BZ/BNZ as they do from INT2.
+ */
+static void
+complete_mul(APEX_CPU *cpu, CPU_Stage *stage)
+{
+	IQ_ENTRY* iq_entry = &stage->iq_entry;
+	APEX_THREAD* thread = &cpu->threads[iq_entry->thread];
+	if (iq_entry->lanes) {
+		complete_lanes(cpu, stage);
+		iq_entry->stage_finished = MUL3;
+		return;
+	}
+	ROB_ENTRY *rob_entry = &thread->ROB[iq_entry->rob_index];
+	rob_entry->exception_codes = 0;
+	thread->rob_done |= 1u << iq_entry->rob_index;
+	rob_entry->result = stage->buffer;
+	trace_event(cpu->trace, TRACE_COMPLETE, iq_entry->seq, iq_entry->pc_value, cpu->clock);
+	cpu->phys_regs[iq_entry->des_physical_reg] = stage->buffer;
+	cpu->phys_regs_valid[iq_entry->des_physical_reg] = 1;
+	// MUL is the latest arithmetic instruction for a BZ/BNZ behind it as much as ADD/SUB
+	if (iq_entry->op == OP_ADD || iq_entry->op == OP_ADDL || iq_entry->op == OP_SUB || iq_entry->op == OP_SUBL || iq_entry->op == OP_MUL) {
+		cpu->flag_condition[iq_entry->des_physical_reg] = (stage->buffer == 0);
+	}
+	int i;
+	iq_wakeup(cpu, iq_entry->des_physical_reg, stage->buffer, 1);
+	//Forward to LSQ entries
+	if(cpu->lsq_current_size > 0) {
+		int counter = cpu->lsq_current_size;
+		for(i = cpu->lsq_head; counter > 0; i = (i+1)%LSQ_SIZE) {
+			LSQ_ENTRY* lsq_entry = &(cpu->LSQ[i]);
+			if(lsq_entry->src1_tag == iq_entry->des_physical_reg && lsq_entry->src1_valid != 1) {
+				lsq_entry->src1_valid = 1;
+				lsq_entry->value = stage->buffer;
+			}
+			counter -= 1;
+		}
+	}
+	if (iq_entry->op != OP_MOVC) {
+		drop_consumer(cpu, iq_entry->src1_tag);
+	}
+	if (iq_entry->op != OP_MOVC && iq_entry->op != OP_ADDL && iq_entry->op != OP_SUBL) {
+		drop_consumer(cpu, iq_entry->src2_tag);
+	}
+	iq_entry->stage_finished = MUL3;
+}
+
 int mul_fu_3(APEX_CPU *cpu)
 {
-	CPU_Stage *stage = &cpu->stage[MUL3];
+	complete_parked(cpu, MUL3, complete_mul);
+	CPU_Stage *stage = cpu->latch[MUL3].cur;
 	IQ_ENTRY* iq_entry = &stage->iq_entry;
 	if (iq_entry && !stage->busy && !stage->stalled && iq_entry->stage_finished < MUL3)
 	{
-		IQ_ENTRY* iq_entry1 = &stage->iq_entry;
-		ROB_ENTRY *rob_entry = &cpu->ROB[iq_entry1->rob_index];	
-		rob_entry->exception_codes = 0;
-		rob_entry->result_valid = 1;
-		rob_entry->result = stage->buffer;
-		cpu->phys_regs[iq_entry->des_physical_reg] = stage->buffer;
-		cpu->phys_regs_valid[iq_entry->des_physical_reg] = 1;
-		int i;
-		for (i = 0; i < IQ_SIZE; i++) {
-			IQ_ENTRY *test_iq_entry = &cpu->IQ[i];
-			if (cpu->iq_free[i] == 0) {
-				if (iq_entry->des_physical_reg == test_iq_entry->src1_tag) {
-					test_iq_entry->src1_value = stage->buffer;
-					test_iq_entry->src1_ready = 1;
-				}
-				if (iq_entry->des_physical_reg == test_iq_entry->src2_tag) {
-					test_iq_entry->src2_value = stage->buffer;
-					test_iq_entry->src2_ready = 1;
-				}
-			}
+		if (!park_for_latency(cpu, stage, MUL3)) {
+			complete_mul(cpu, stage);
 		}
-		//Forward to LSQ entries
-		if(cpu->lsq_current_size > 0) {
-			int counter = cpu->lsq_current_size;
-			for(i = cpu->lsq_head; counter > 0; i = (i+1)%LSQ_SIZE) {
-				LSQ_ENTRY* lsq_entry = &(cpu->LSQ[i]);
-				if(lsq_entry->src1_tag == iq_entry->des_physical_reg) {
-					lsq_entry->src1_valid = 1;
-					lsq_entry->value = stage->buffer;
-				}
-				counter -= 1;
-			}
-		}
-		cpu->consumers[iq_entry1->src1_tag] -= 1;
-		cpu->consumers[iq_entry1->src2_tag] -= 1;
-		iq_entry->stage_finished = MUL3;
-		if (ENABLE_DEBUG_MESSAGES) {
+		if (LOG_ENABLED(LOG_EXEC, LOG_DEBUG)) {
 			print_stage_content("Instruction at MUL3_FU_STAGE--->", stage, iq_entry->stage_finished == MUL3, cpu, iq_entry, MUL3);
 		}
 	}
-	else if (ENABLE_DEBUG_MESSAGES) {
+	else if (LOG_ENABLED(LOG_EXEC, LOG_DEBUG)) {
 		print_stage_content("Instruction at MUL3_FU_STAGE--->", stage, 0, cpu, iq_entry, MUL3);
 	}
 	return 0;
-	//TODO: Decrement the consumer count of the source physical registers
+}
+
+/* Resolves the BZ/BNZ or JUMP in stage */
+static void
+complete_branch(APEX_CPU *cpu, CPU_Stage *stage)
+{
+	IQ_ENTRY* iq_entry = &stage->iq_entry;
+	APEX_THREAD* thread = &cpu->threads[iq_entry->thread];
+	ROB_ENTRY *rob_entry = &thread->ROB[iq_entry->rob_index];
+	rob_entry->exception_codes = 0;
+	thread->rob_done |= 1u << iq_entry->rob_index;
+	trace_event(cpu->trace, TRACE_COMPLETE, iq_entry->seq, iq_entry->pc_value, cpu->clock);
+	stage->buffer = iq_entry->pc_value + iq_entry->literal;
+	// The flag register of BZ/BNZ or the target register of JUMP
+	if(iq_entry->src1_tag > -1) {
+		drop_consumer(cpu, iq_entry->src1_tag);
+	}
+	if(iq_entry->op == OP_BZ || iq_entry->op == OP_BNZ) {
+		resolve_conditional_branch(cpu, thread, iq_entry, iq_entry->op == OP_BZ, iq_entry->pc_value, stage->buffer, iq_entry->src1_value);
+	} else {
+		//Inst is JUMP
+		//flush and go to target address
+		thread->jump_pending = 0;
+		request_flush(thread, NULL, iq_entry, iq_entry->src1_value + iq_entry->literal);
+	}
+	iq_entry->stage_finished = BRANCH;
 }
 
 int branch_fu(APEX_CPU *cpu)
 {
-	CPU_Stage *stage = &cpu->stage[BRANCH];
+	complete_parked(cpu, BRANCH, complete_branch);
+	CPU_Stage *stage = cpu->latch[BRANCH].cur;
 	IQ_ENTRY* iq_entry = &stage->iq_entry;
 	if(iq_entry && !stage->busy && !stage->stalled && iq_entry->stage_finished < BRANCH) {
-		ROB_ENTRY *rob_entry = &cpu->ROB[iq_entry->rob_index];
-		rob_entry->exception_codes = 0;
-		rob_entry->result_valid = 1;
-		stage->buffer = iq_entry->pc_value + iq_entry->literal;
-		BTB_ENTRY* btb_entry;
-		int i;
-		if(strcmp(iq_entry->opcode, "BZ") == 0 || strcmp(iq_entry->opcode, "BNZ") == 0) {
-			for(i = 0; i < BTB_SIZE; i++) {
-				btb_entry = (&cpu->BTB[i]);
-				if(btb_entry->branch_ins_pc_value == iq_entry->pc_value) {
-					btb_entry->target_pc_value = stage->buffer;
-					break;
-				}
-			}
-			if(strcmp(iq_entry->opcode, "BZ") == 0 && ((iq_entry->src1_value == 1 && btb_entry->history_bit == 0) || (iq_entry->src1_value == 0 && btb_entry->history_bit == 1))) {
-				//flush and go to target address
-				int target_pc_value;
-				if(btb_entry->history_bit == 0) {
-					target_pc_value = btb_entry->target_pc_value;
-				} else {
-					target_pc_value = btb_entry->branch_ins_pc_value  + 4;
-				}
-				mispredicted_branch_btb_entry = btb_entry;
-				mispredicted_branch_iq_entry = iq_entry;
-				mispredicted_branch_target_address_new = target_pc_value;
-				flush_and_reload = 1;
-				stop_fetch_decode = 0;
-			} else if(strcmp(iq_entry->opcode, "BNZ") == 0 && ((iq_entry->src1_value == 0 && btb_entry->history_bit == 0) || (iq_entry->src1_value == 1 && btb_entry->history_bit == 1))) {
-				//flush and go to target address
-				int target_pc_value;
-				if(btb_entry->history_bit == 0) {
-					target_pc_value = btb_entry->target_pc_value;
-				} else {
-					target_pc_value = btb_entry->branch_ins_pc_value  + 4;
-				}
-				mispredicted_branch_btb_entry = btb_entry;
-				mispredicted_branch_iq_entry = iq_entry;
-				mispredicted_branch_target_address_new = target_pc_value;
-				flush_and_reload = 1;
-				stop_fetch_decode = 0;
-			}
-			if(strcmp(iq_entry->opcode, "BZ") == 0) {
-				if(iq_entry->src1_value == 1) {
-					btb_entry->history_bit = 1;
-				} else {
-					btb_entry->history_bit = 0;
-				}
-			} else {
-				if(strcmp(iq_entry->opcode, "BNZ") == 0) {
-				if(iq_entry->src1_value == 0) {
-					btb_entry->history_bit = 1;
-				} else {
-					btb_entry->history_bit = 0;
-				}
-			}
-			}
-		} else {
-			//Inst is JUMP
-			//flush and go to target address
-			mispredicted_branch_btb_entry = NULL;
-			mispredicted_branch_iq_entry = iq_entry;
-			mispredicted_branch_target_address_new = iq_entry->src1_value + iq_entry->literal;
-			flush_and_reload = 1;
-			stop_fetch_decode = 0;
-		}
-		(&cpu->stage[F])->stalled = (&cpu->stage[DRF])->stalled = 0;
-		iq_entry->stage_finished = BRANCH;
-		if (ENABLE_DEBUG_MESSAGES) {
+		if (!park_for_latency(cpu, stage, BRANCH)) {
+			complete_branch(cpu, stage);
+		}
+		if (LOG_ENABLED(LOG_EXEC, LOG_DEBUG)) {
 			print_stage_content("Instruction at BRANCH_FU_STAGE--->", stage, iq_entry->stage_finished == BRANCH, cpu, iq_entry, BRANCH);
 		}
 	}
-	else if (ENABLE_DEBUG_MESSAGES) {
+	else if (LOG_ENABLED(LOG_EXEC, LOG_DEBUG)) {
 		print_stage_content("Instruction at BRANCH_FU_STAGE--->", stage, 0, cpu, iq_entry, BRANCH);
 	}
 	return 0;
 }
 
+/* bis_index of squash_lsq_entries dropping every entry of the thread */
+#define ALL_BIS_INDEXES -3
+
+/*
+ * Takes back the source reads decode counted in consumers for iq_entry,
+ * which is squashed before completing would have done it.
+ */
+static void
+release_consumers(APEX_CPU* cpu, IQ_ENTRY* iq_entry)
+{
+	if(iq_entry->op == OP_MOVC || iq_entry->op == OP_HALT) {
+		return;
+	}
+	if(iq_entry->src1_tag > -1) {
+		drop_consumer(cpu, iq_entry->src1_tag);
+	}
+	// STORE/VSTORE carry their base in both tags, but decode counted it once
+	if(iq_entry->src2_tag > -1 && iq_entry->op != OP_STORE && iq_entry->op != OP_VSTORE) {
+		drop_consumer(cpu, iq_entry->src2_tag);
+	}
+	for(int lane = 0; lane < iq_entry->lanes; lane++) {
+		if(iq_entry->lane_src1_tags[lane] > -1) {
+			drop_consumer(cpu, iq_entry->lane_src1_tags[lane]);
+		}
+		if(iq_entry->lane_src2_tags[lane] > -1) {
+			drop_consumer(cpu, iq_entry->lane_src2_tags[lane]);
+		}
+	}
+}
+
+/* Drops the parked instructions of thread under bis_index or second_bis_index */
+static void
+squash_parked(APEX_CPU* cpu, int thread, int bis_index, int second_bis_index)
+{
+	for (uint64_t parked = cpu->parked_valid; parked; parked &= parked - 1) {
+		int slot = __builtin_ctzll(parked);
+		IQ_ENTRY* entry = &cpu->parked[slot].iq_entry;
+		if(entry->thread == thread && (bis_index == ALL_BIS_INDEXES || entry->bis_index == bis_index || entry->bis_index == second_bis_index)) {
+			if(bis_index != ALL_BIS_INDEXES) {
+				release_consumers(cpu, entry);
+			}
+			cpu->parked_valid &= ~(1ull << slot);
+		}
+	}
+}
+
+/*
+ * Flush of the shared LSQ: drops thread's entries younger than the
+ * mispredicted branch (all of them with ALL_BIS_INDEXES) and closes the
+ * gaps, keeping the other threads' entries in order.
+ */
+static void
+squash_lsq_entries(APEX_CPU* cpu, int thread, int bis_index, int second_bis_index) {
+	int kept[LSQ_SIZE];
+	int kept_size = 0;
+	int counter = cpu->lsq_current_size;
+	for(int i = cpu->lsq_head; counter > 0; i = (i+1)%LSQ_SIZE) {
+		if(cpu->lsq_thread[i] != thread || (bis_index != ALL_BIS_INDEXES && cpu->lsq_bis_index[i] != bis_index && cpu->lsq_bis_index[i] != second_bis_index)) {
+			kept[kept_size++] = i;
+		}
+		counter -= 1;
+	}
+	if(kept_size == cpu->lsq_current_size) {
+		return;
+	}
+	// Where each slot's entry moved to, kept entries only ever move towards the head
+	int moved_to[LSQ_SIZE];
+	for(int i = 0; i < LSQ_SIZE; i++) {
+		moved_to[i] = i;
+	}
+	for(int j = 0; j < kept_size; j++) {
+		int from = kept[j];
+		int to = (cpu->lsq_head + j) % LSQ_SIZE;
+		moved_to[from] = to;
+		if(from != to) {
+			cpu->LSQ[to] = cpu->LSQ[from];
+			cpu->lsq_thread[to] = cpu->lsq_thread[from];
+			cpu->lsq_rob_index[to] = cpu->lsq_rob_index[from];
+			cpu->lsq_bis_index[to] = cpu->lsq_bis_index[from];
+		}
+	}
+	cpu->lsq_current_size = kept_size;
+	cpu->lsq_tail = (cpu->lsq_head + kept_size - 1 + LSQ_SIZE) % LSQ_SIZE;
+	// Squashed entries are already gone from the IQ and FU latches, point the rest at where their LSQ entry moved
+	for(uint32_t valid = cpu->iq_valid; valid; valid &= valid - 1) {
+		IQ_ENTRY* entry = &cpu->IQ[__builtin_ctz(valid)];
+		if(entry->lsq_index > -1 && entry->lsq_index < LSQ_SIZE) {
+			entry->lsq_index = moved_to[entry->lsq_index];
+		}
+	}
+	for(int i = INT1; i <= MUL3; i++) {
+		IQ_ENTRY* entry = &cpu->latch[i].cur->iq_entry;
+		if(entry->lsq_index > -1 && entry->lsq_index < LSQ_SIZE) {
+			entry->lsq_index = moved_to[entry->lsq_index];
+		}
+	}
+}
+
+/* Points fetch of thread at target_address, dropping what the front end queued */
+static void
+redirect_fetch(APEX_THREAD* thread, int target_address) {
+	thread->pc = target_address;
+	thread->recovery_pending = 1;
+	// The decoupled front end predicts and fetches from the target again
+	thread->ftq_count = thread->fetch_buffer_count = 0;
+	// and a streamed loop has been left
+	thread->loop_buffer.streaming = 0;
+	thread->loop_buffer.iterations = 0;
+}
+
+/* Empties the fetch and decode latches of thread after a redirect */
+static void
+squash_front_end_latches(APEX_CPU* cpu, APEX_THREAD* thread) {
+	CPU_Stage* fetch_stage = thread->latch[F].cur;
+	fetch_stage->op = OP_NOP;
+	CPU_Stage* decode_stage = thread->latch[DRF].cur;
+	decode_stage->op = OP_NOP;
+	// A fetched instruction still waiting in the decode latch is lost too
+	if(decode_stage->seq > thread->last_dispatched_seq) {
+		trace_event(cpu->trace, TRACE_SQUASH, decode_stage->seq, decode_stage->pc, cpu->clock);
+		decode_stage->seq = 0;
+	}
+	decode_stage->stalled = 0;
+	// and so is one fetched behind it while it stalled
+	CPU_LATCH* decode_latch = &thread->latch[DRF];
+	if(decode_latch->written) {
+		trace_event(cpu->trace, TRACE_SQUASH, decode_latch->next->seq, decode_latch->next->pc, cpu->clock);
+		decode_latch->next->op = OP_NOP;
+		decode_latch->written = 0;
+	}
+	decode_latch->held = 0;
+	thread->jump_pending = 0;
+}
+
+/*
+ * Trains the value predictor entry of the load at pc with the value it
+ * read, and counts how the prediction went if it made one.
+ */
+static void
+train_value_predictor(APEX_CPU* cpu, APEX_THREAD* thread, int pc, int value, int predicted, int correct) {
+	LVP_ENTRY* entry = lvp_entry(thread, pc);
+	cpu->lvp_loads += 1;
+	cpu->lvp_predicted += predicted;
+	cpu->lvp_correct += predicted && correct;
+	if(entry->pc == pc && entry->value == value) {
+		if(entry->confidence < LVP_CONFIDENT) {
+			entry->confidence += 1;
+		}
+	} else {
+		entry->pc = pc;
+		entry->value = value;
+		entry->confidence = 0;
+	}
+}
+
+/*
+ * Load value misprediction. The load at the ROB head of thread_id read a
+ * value other than the one its dependents got at dispatch, and has left
+ * the LSQ. Everything of the thread younger than it is squashed, rename
+ * state goes back to what has retired plus the load, and fetch restarts
+ * after it, so the dependents are dispatched again with the real value.
+ */
+static void
+replay_after_load(APEX_CPU* cpu, int thread_id) {
+	APEX_THREAD* thread = &cpu->threads[thread_id];
+	ROB_ENTRY* load = &thread->ROB[thread->rob_head];
+	if(cpu->flush_hook) {
+		cpu->flush_hook(cpu->flush_hook_data, load->pc_value, load->pc_value + 4, cpu->clock);
+	}
+	redirect_fetch(thread, load->pc_value + 4);
+	thread->stop_fetch_decode = 0;
+	int i;
+	for(i = 0; i < IQ_SIZE; i++) {
+		if(cpu->iq_thread[i] == thread_id) {
+			cpu->iq_valid &= ~(1u << i);
+			cpu->iq_held &= ~(1u << i);
+		}
+	}
+	// What the thread has left in the LSQ is younger, keep memory_issue off the emptied slots
+	int counter = cpu->lsq_current_size;
+	for(i = cpu->lsq_head; counter > 0; i = (i+1)%LSQ_SIZE) {
+		if(cpu->lsq_thread[i] == thread_id) {
+			cpu->LSQ[i].address_valid = 0;
+		}
+		counter -= 1;
+	}
+	squash_lsq_entries(cpu, thread_id, ALL_BIS_INDEXES, ALL_BIS_INDEXES);
+	squash_parked(cpu, thread_id, ALL_BIS_INDEXES, ALL_BIS_INDEXES);
+	for(i = INT1; i <= BRANCH; i++) {
+		CPU_Stage* stage = cpu->latch[i].cur;
+		if(stage->iq_entry.thread == thread_id) {
+			stage->op = OP_NOP;
+			stage->iq_entry.stage_finished = NUM_STAGES;
+		}
+	}
+	for(i = thread->rob_head; i != thread->rob_tail; ) {
+		i = (i+1)%ROB_SIZE;
+		count_writers(cpu, thread, i, -1);
+		trace_rob_squash(cpu, thread, i);
+	}
+	thread->rob_tail = thread->rob_head;
+	thread->rob_current_size = 1;
+	// No branch of the thread is in flight any more
+	if(thread->bis_head != -1) {
+		thread->bis_tail = (thread->bis_head - 1 + BIS_SIZE) % BIS_SIZE;
+	}
+	thread->bis_current_size = 0;
+	memcpy(thread->rename_table, thread->retired_rename_table, sizeof(thread->rename_table));
+	thread->rename_table[load->arch_register] = load->phys_register;
+	thread->latest_arithmetic_inst_phys_reg = thread->retired_arithmetic_phys_reg;
+	count_rename_refs(cpu);
+	count_checkpoint_refs(cpu);
+	// Nothing of the thread in flight reads its registers now, all but the mapped ones are free
+	for(i = 0; i < cpu->prf_size; i++) {
+		if(cpu->phys_reg_owner[i] == thread_id) {
+			cpu->consumers[i] = 0;
+			cpu->free_PR_list[i] = 0;
+			release_register(cpu, i);
+		}
+	}
+	squash_front_end_latches(cpu, thread);
+}
+
+/*
+ * Performs the VLEN word access of the VLOAD/VSTORE in lsq_entry, whose
+ * lanes go through the data memory in one block. VSTORE data is read
+ * from the lane registers here, which its consumers have kept.
+ */
+static void
+access_lanes(APEX_CPU *cpu, LSQ_ENTRY *lsq_entry, ROB_ENTRY *rob_entry) {
+	uint32_t address = (uint32_t) lsq_entry->calculated_mem_address;
+	int values[VLEN];
+	if(lsq_entry->ins_type == 1) {
+		for(int lane = 0; lane < VLEN; lane++) {
+			values[lane] = lane_value(cpu, lsq_entry->lane_tags[lane]);
+			if(lsq_entry->lane_tags[lane] > -1) {
+				drop_consumer(cpu, lsq_entry->lane_tags[lane]);
+			}
+		}
+		if(cpu->l1) {
+			l1_write_words(cpu->l1, address, values, VLEN);
+		} else {
+			mem_write_words(&cpu->data_memory, address, values, VLEN);
+		}
+	} else {
+		if(cpu->l1) {
+			l1_read_words(cpu->l1, address, values, VLEN);
+		} else {
+			mem_read_words(&cpu->data_memory, address, values, VLEN);
+		}
+		write_lanes(cpu, rob_entry, values);
+	}
+}
+
+/* The word at address as a load reads it, through the L1 when there is one */
+static int
+load_word(APEX_CPU *cpu, uint32_t address) {
+	return cpu->l1 ? l1_read_word(cpu->l1, address) : mem_read(&cpu->data_memory, address);
+}
+
 int memory_issue(APEX_CPU *cpu) {
-	if(cpu->lsq_head == -1) {
+	// The head of an emptied LSQ is the slot the next entry goes in, not an entry
+	if(cpu->lsq_head == -1 || cpu->lsq_current_size == 0) {
 		//Nothing to do here
 		return 0;
 	}
 	LSQ_ENTRY *lsq_entry = &cpu->LSQ[cpu->lsq_head];
-	if(lsq_entry->rob_index == cpu->rob_head && lsq_entry->address_valid == 1 && ((lsq_entry->ins_type == 1 && lsq_entry->src1_valid == 1) || lsq_entry->ins_type == 0)) {
-		if(lsq_entry->cycle_counter < 3) {
+	int thread_id = cpu->lsq_thread[cpu->lsq_head];
+	int rob_index = cpu->lsq_rob_index[cpu->lsq_head];
+	APEX_THREAD *thread = &cpu->threads[thread_id];
+	if(rob_index == thread->rob_head && lsq_entry->address_valid == 1 && ((lsq_entry->ins_type == 1 && store_data_ready(cpu, lsq_entry)) || lsq_entry->ins_type == 0)) {
+		if(lsq_entry->cycle_counter < lsq_entry->access_cycles) {
 			lsq_entry->cycle_counter++;
+			if(lsq_entry->cycle_counter == lsq_entry->access_cycles - 1 && lsq_entry->ins_type == 0 && cpu->load_speculation_enabled && !lsq_entry->value_predicted && !lsq_entry->lanes) {
+				// Dependents issuing now meet the value in their FU if the load hits
+				int dest = thread->ROB[rob_index].phys_register;
+				int value = load_word(cpu, (uint32_t) lsq_entry->calculated_mem_address);
+				if(iq_speculative_wakeup(cpu, dest, value)) {
+					cpu->spec_load_reg = dest;
+					cpu->spec_load_value = value;
+					cpu->spec_loads += 1;
+				}
+			}
+		}
+		if(lsq_entry->cycle_counter >= lsq_entry->access_cycles && cpu->l1 && !lsq_entry->l1_accessed) {
+			// Multi-core: the coherence transaction may add fill or transfer cycles
+			lsq_entry->l1_accessed = 1;
+			lsq_entry->l1_wait = l1_access(cpu->l1, (uint32_t) lsq_entry->calculated_mem_address, lsq_entry->ins_type == 1, cpu->clock);
+			uint32_t last_word = (uint32_t) lsq_entry->calculated_mem_address + VLEN - 1;
+			if(lsq_entry->lanes && (last_word >> L1_LINE_BITS) != ((uint32_t) lsq_entry->calculated_mem_address >> L1_LINE_BITS)) {
+				// Lanes spilling into the next line access it after the first
+				lsq_entry->l1_wait += l1_access(cpu->l1, last_word, lsq_entry->ins_type == 1, cpu->clock);
+			}
+			if(cpu->prefetcher) {
+				prefetcher_observe(cpu->prefetcher, lsq_entry->pc, (uint32_t) lsq_entry->calculated_mem_address, cpu->clock);
+			}
+			if(lsq_entry->l1_wait > 0 && cpu->spec_load_reg > -1) {
+				cancel_speculative_wakeup(cpu);
+			}
 		}
-		if(lsq_entry->cycle_counter == 3) {
-			ROB_ENTRY* rob_entry = &cpu->ROB[lsq_entry->rob_index];
+		if(lsq_entry->cycle_counter >= lsq_entry->access_cycles && lsq_entry->l1_wait > 0) {
+			lsq_entry->l1_wait -= 1;
+		} else if(lsq_entry->cycle_counter >= lsq_entry->access_cycles) {
+			int mispredicted = 0;
+			ROB_ENTRY* rob_entry = &thread->ROB[rob_index];
 			rob_entry->exception_codes = 0;
-			rob_entry->result_valid = 1;
-			if (lsq_entry->ins_type == 1) {
-				cpu->data_memory[lsq_entry->calculated_mem_address] = lsq_entry->value;
+			thread->rob_done |= 1u << rob_index;
+			trace_event(cpu->trace, TRACE_COMPLETE, thread->rob_seq[rob_index], rob_entry->pc_value, cpu->clock);
+			if (lsq_entry->lanes) {
+				access_lanes(cpu, lsq_entry, rob_entry);
+			} else if (lsq_entry->ins_type == 1 && cpu->l1) {
+				l1_write_word(cpu->l1, (uint32_t) lsq_entry->calculated_mem_address, lsq_entry->value);
+			} else if (lsq_entry->ins_type == 1) {
+				mem_write(&cpu->data_memory, (uint32_t) lsq_entry->calculated_mem_address, lsq_entry->value);
 			} else {
-				rob_entry->result = cpu->data_memory[lsq_entry->calculated_mem_address];
+				rob_entry->result = load_word(cpu, (uint32_t) lsq_entry->calculated_mem_address);
+				if(cpu->value_prediction_enabled) {
+					// Until now the register held the predicted value
+					mispredicted = lsq_entry->value_predicted && cpu->phys_regs[rob_entry->phys_register] != rob_entry->result;
+					train_value_predictor(cpu, thread, lsq_entry->pc, rob_entry->result, lsq_entry->value_predicted, !mispredicted);
+				}
 				cpu->phys_regs[rob_entry->phys_register] = rob_entry->result;
 				cpu->phys_regs_valid[rob_entry->phys_register] = 1;
 				int i;
-				for (i = 0; i < IQ_SIZE; i++) {
-					IQ_ENTRY *iq_entry = &cpu->IQ[i];
-					if (cpu->iq_free[i] == 0) {
-						if (rob_entry->phys_register == iq_entry->src1_tag) {
-							iq_entry->src1_value = rob_entry->result;
-							iq_entry->src1_ready = 1;
-						}
-						if (rob_entry->phys_register == iq_entry->src2_tag) {
-							iq_entry->src2_value = rob_entry->result;
-							iq_entry->src2_ready = 1;
-						}
-					}
+				if(cpu->spec_load_reg > -1 && (cpu->spec_load_reg != rob_entry->phys_register || cpu->spec_load_value != rob_entry->result)) {
+					// Memory changed since the wakeup, the dependents ran on a stale value
+					cancel_speculative_wakeup(cpu);
+				}
+				iq_wakeup(cpu, rob_entry->phys_register, rob_entry->result, 0);
+				if(cpu->spec_load_reg > -1) {
+					confirm_speculative_wakeup(cpu);
 				}
 				if((cpu->lsq_current_size - 1) > 0) {
 					int counter = cpu->lsq_current_size - 1;
-					for(i = cpu->lsq_head + 1; counter > 0; i = (i+1)%LSQ_SIZE) {
+					for(i = (cpu->lsq_head + 1) % LSQ_SIZE; counter > 0; i = (i+1)%LSQ_SIZE) {
 						LSQ_ENTRY* lsq_entry = &(cpu->LSQ[i]);
-						if(lsq_entry->src1_tag == rob_entry->phys_register) {
+						if(lsq_entry->src1_tag == rob_entry->phys_register && lsq_entry->src1_valid != 1) {
 							lsq_entry->src1_valid = 1;
 							lsq_entry->value = rob_entry->result;
 						}
@@ -1117,17 +2716,24 @@ int memory_issue(APEX_CPU *cpu) {
 					}
 				}
 			}
+			PC_PROFILE* profile = profile_of(thread, lsq_entry->pc);
+			if(profile) {
+				profile->lsq_cycles += cpu->clock - lsq_entry->dispatch_cycle + 1;
+			}
 			int next_head = cpu->lsq_head + 1;
 			cpu->lsq_current_size -= 1;
 			cpu->lsq_head = next_head % LSQ_SIZE;
+			if(mispredicted) {
+				replay_after_load(cpu, thread_id);
+			}
 		}
-		if (ENABLE_DEBUG_MESSAGES) {
-			printf("Instruction at MEM_FU_STAGE--->");
+		if (LOG_ENABLED(LOG_MEM, LOG_DEBUG)) {
+			log_printf("Instruction at MEM_FU_STAGE--->");
 			print_lsq(cpu, lsq_entry);
-			printf(" (Cycle %d)\n", lsq_entry->cycle_counter);
+			log_printf(" (Cycle %d)\n", lsq_entry->cycle_counter);
 		}
-	} else {
-		printf("Instruction at MEM_FU_STAGE---> EMPTY\n");
+	} else if (LOG_ENABLED(LOG_MEM, LOG_DEBUG)) {
+		log_printf("Instruction at MEM_FU_STAGE---> EMPTY\n");
 	}
 	// if (ENABLE_DEBUG_MESSAGES) {
 	// 	fprintf(stderr, "MEM");
@@ -1136,98 +2742,228 @@ int memory_issue(APEX_CPU *cpu) {
 	return 0;
 }
 
-int instruction_retirement(APEX_CPU *cpu) {
-	if(cpu->rob_head == -1) {
+/* Retires the VLEN lane results of a vector rob_entry into the ARF */
+static void
+retire_lanes(APEX_CPU *cpu, APEX_THREAD *thread, ROB_ENTRY *rob_entry) {
+	for(int lane = 0; lane < VLEN; lane++) {
+		int arch_register = rob_entry->arch_register + lane;
+		int phys_register = rob_entry->lane_phys_registers[lane];
+		thread->regs[arch_register] = rob_entry->lane_results[lane];
+		move_register_ref(cpu, cpu->retired_refs, &thread->retired_rename_table[arch_register], phys_register);
+	}
+}
+
+/*
+ * Frees the BIS entry of the BZ/BNZ of thread at the head of the BIS as
+ * it commits. The instructions dispatched behind it still carry its tag,
+ * which the next branch may be given, so they are untagged: they are
+ * older than every branch still in flight and no flush takes them.
+ */
+static void
+release_branch_tag(APEX_CPU *cpu, APEX_THREAD *thread) {
+	int thread_id = thread - cpu->threads;
+	int bis_index = thread->bis_head;
+	int i;
+	for(i = 0; i < IQ_SIZE; i++) {
+		if(cpu->iq_thread[i] == thread_id && cpu->iq_bis_index[i] == bis_index) {
+			cpu->iq_bis_index[i] = cpu->IQ[i].bis_index = -1;
+		}
+	}
+	for(uint64_t parked = cpu->parked_valid; parked; parked &= parked - 1) {
+		IQ_ENTRY* entry = &cpu->parked[__builtin_ctzll(parked)].iq_entry;
+		if(entry->thread == thread_id && entry->bis_index == bis_index) {
+			entry->bis_index = -1;
+		}
+	}
+	for(i = INT1; i <= BRANCH; i++) {
+		IQ_ENTRY* entry = &cpu->latch[i].cur->iq_entry;
+		if(entry->thread == thread_id && entry->bis_index == bis_index) {
+			entry->bis_index = -1;
+		}
+	}
+	for(i = 0; i < LSQ_SIZE; i++) {
+		if(cpu->lsq_thread[i] == thread_id && cpu->lsq_bis_index[i] == bis_index) {
+			cpu->lsq_bis_index[i] = -1;
+		}
+	}
+	count_checkpoint(cpu, thread, &thread->BIS[bis_index], -1);
+	thread->bis_head = (thread->bis_head + 1) % BIS_SIZE;
+	thread->bis_current_size -= 1;
+}
+
+/*
+ * Retires the instruction fused into rob_entry besides its own, the MOVC
+ * before it or the BZ/BNZ after it.
+ */
+static void
+retire_fused(APEX_CPU *cpu, APEX_THREAD *thread, ROB_ENTRY *rob_entry) {
+	PC_PROFILE* profile = profile_of(thread, rob_entry->fused_pc);
+	if(profile) {
+		profile->commits += 1;
+	}
+	trace_event(cpu->trace, TRACE_COMMIT, rob_entry->fused_seq, rob_entry->fused_pc, cpu->clock);
+	int arch_register = -1;
+	int result = 0;
+	if(rob_entry->fused == FUSED_MOVC) {
+		arch_register = rob_entry->fused_arch_register;
+		result = rob_entry->fused_result;
+		thread->regs[arch_register] = result;
+		move_register_ref(cpu, cpu->retired_refs, &thread->retired_rename_table[arch_register], rob_entry->fused_phys_register);
+	} else {
+		release_branch_tag(cpu, thread);
+	}
+	cpu->ins_completed += 1;
+	thread->ins_completed += 1;
+	cpu->last_commit_pc = rob_entry->fused_pc;
+	if(cpu->commit_hook) {
+		APEX_COMMIT_INFO info = {rob_entry->fused_pc, cpu->clock, arch_register, result,
+					 thread->code_memory[get_code_index(rob_entry->fused_pc)].opcode};
+		cpu->commit_hook(cpu->commit_hook_data, &info);
+	}
+}
+
+int instruction_retirement(APEX_CPU *cpu, APEX_THREAD *thread) {
+	// The head of an emptied ROB is the slot the next entry goes in, its squashed entry may still read as done
+	if(thread->rob_head == -1 || thread->rob_current_size == 0) {
 		//Nothing to commit
 		return 0;
 	}
-	ROB_ENTRY *rob_entry = &cpu->ROB[cpu->rob_head];
-	if(rob_entry->result_valid == 1) {
-		char* opcode = rob_entry->instruction_type;
-		if(!(strcmp(opcode, "STORE") == 0 || strcmp(opcode, "STR") == 0 || strcmp(opcode, "BZ") == 0 || strcmp(opcode, "BNZ") == 0 || strcmp(opcode, "JUMP") == 0 || strcmp(opcode, "HALT") == 0 )) {
-			cpu->regs[rob_entry->arch_register] = rob_entry->result;
-			if(cpu->consumers[rob_entry->phys_register] == 0 && cpu->rename_table[rob_entry->arch_register] != rob_entry->phys_register) {
-				cpu->free_PR_list[rob_entry->phys_register] = 1;
+	int rob_index = thread->rob_head;
+	ROB_ENTRY *rob_entry = &thread->ROB[rob_index];
+	PC_PROFILE* profile = profile_of(thread, rob_entry->pc_value);
+	if(profile) {
+		profile->rob_head_cycles += 1;
+	}
+	if(thread->rob_done & (1u << rob_index)) {
+		if(rob_entry->fused == FUSED_MOVC) {
+			retire_fused(cpu, thread, rob_entry);
+		}
+		if(profile) {
+			profile->commits += 1;
+		}
+		trace_event(cpu->trace, TRACE_COMMIT, thread->rob_seq[rob_index], rob_entry->pc_value, cpu->clock);
+		int op = rob_entry->op;
+		int arch_register = -1;
+		if(rob_entry->lanes) {
+			arch_register = rob_entry->arch_register;
+			retire_lanes(cpu, thread, rob_entry);
+		} else if(!(op == OP_STORE || op == OP_STR || op == OP_BZ || op == OP_BNZ || op == OP_JUMP || op == OP_HALT || op == OP_VSTORE)) {
+			arch_register = rob_entry->arch_register;
+			thread->regs[rob_entry->arch_register] = rob_entry->result;
+			move_register_ref(cpu, cpu->retired_refs, &thread->retired_rename_table[rob_entry->arch_register], rob_entry->phys_register);
+			if(cpu->value_prediction_enabled && (op == OP_ADD || op == OP_ADDL || op == OP_SUB || op == OP_SUBL || op == OP_MUL)) {
+				move_register_ref(cpu, cpu->retired_refs, &thread->retired_arithmetic_phys_reg, rob_entry->phys_register);
 			}
-		}if(strcmp(opcode, "HALT") == 0) {
-			return 1;
-		}if(strcmp(opcode, "BZ") == 0 || strcmp(opcode, "BNZ") == 0) {
-			cpu->bis_head = (cpu->bis_head + 1) % BIS_SIZE;
-			cpu->bis_current_size -= 1;
-		}
-		if(ENABLE_DEBUG_MESSAGES) {
-			printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
-			printf("Details of ROB Retired Instructions –\n");
-			print_rob(cpu, rob_entry->pc_value);
-			printf("\n");
-			printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
-		}
-
-		int next_head = cpu->rob_head + 1;
-		cpu->rob_head = next_head % ROB_SIZE;
-		cpu->rob_current_size -= 1;
-		free_physical_registers(cpu, -1,-1,-1);
+		}if(op == OP_BZ || op == OP_BNZ) {
+			release_branch_tag(cpu, thread);
+		}
+		if(LOG_ENABLED(LOG_COMMIT, LOG_DEBUG)) {
+			log_printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+			log_printf("Details of ROB Retired Instructions –\n");
+			print_rob(thread, rob_entry->pc_value);
+			log_printf("\n");
+			log_printf("~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~\n");
+		}
+
+		int next_head = thread->rob_head + 1;
+		thread->rob_head = next_head % ROB_SIZE;
+		thread->rob_current_size -= 1;
+		count_writers(cpu, thread, rob_index, -1);
 		cpu->ins_completed += 1;
+		thread->ins_completed += 1;
+		cpu->last_commit_pc = rob_entry->pc_value;
+		cpu->last_commit_clock = cpu->clock;
+		if(cpu->commit_hook) {
+			APEX_COMMIT_INFO info = {rob_entry->pc_value, cpu->clock, arch_register, rob_entry->result, opcode_names[op]};
+			cpu->commit_hook(cpu->commit_hook_data, &info);
+		}
+		if(rob_entry->fused == FUSED_BZ || rob_entry->fused == FUSED_BNZ) {
+			retire_fused(cpu, thread, rob_entry);
+		}
+		// HALT is counted and hooked like any other commit before the thread stops
+		if(op == OP_HALT) {
+			return 1;
+		}
 	}
 	return 0;
 }
 int flush(APEX_CPU* cpu, BTB_ENTRY* btb_entry, IQ_ENTRY* iq_entry, int target_address) {
-	cpu->pc = target_address;
-	fprintf(stderr, "target address updated = %d\n", cpu->pc);
-	if(strcmp(iq_entry->opcode, "BZ") == 0 || strcmp(iq_entry->opcode, "BNZ") == 0) {
+	APEX_THREAD* thread = &cpu->threads[iq_entry->thread];
+	int fused_branch = iq_entry->fused == FUSED_BZ || iq_entry->fused == FUSED_BNZ;
+	if(cpu->flush_hook) {
+		cpu->flush_hook(cpu->flush_hook_data, fused_branch ? iq_entry->fused_pc : iq_entry->pc_value, target_address, cpu->clock);
+	}
+	redirect_fetch(thread, target_address);
+	APEX_LOG(LOG_FLUSH, LOG_TRACE, "target address updated = %d\n", thread->pc);
+	if(iq_entry->op == OP_BZ || iq_entry->op == OP_BNZ || fused_branch) {
 		int bis_index = iq_entry->bis_index;
 		int second_bis_index = -2;
-		if(bis_index != cpu->bis_tail) {
-			second_bis_index = cpu->bis_tail;
+		if(bis_index != thread->bis_tail) {
+			second_bis_index = thread->bis_tail;
 		}
 		int i;
 		for(i = 0; i < IQ_SIZE; i++) {
-			IQ_ENTRY* entry = &(cpu->IQ[i]);
-			if(entry->bis_index == bis_index || entry->bis_index == second_bis_index) {
-				cpu->iq_free[i] = 1;
-			}
-		}
-		if(cpu->lsq_current_size > 0) {
-			int counter = cpu->lsq_current_size;
-			for(i = cpu->lsq_head; counter > 0; i = (i+1)%LSQ_SIZE) {
-				LSQ_ENTRY* entry = &(cpu->LSQ[i]);
-				if(entry->bis_index == bis_index || entry->bis_index == second_bis_index) {
-					cpu->lsq_head++;
-					cpu->lsq_current_size -= 1;
+			if(cpu->iq_thread[i] == iq_entry->thread && (cpu->iq_bis_index[i] == bis_index || cpu->iq_bis_index[i] == second_bis_index)) {
+				if(cpu->iq_valid & (1u << i)) {
+					release_consumers(cpu, &cpu->IQ[i]);
 				}
-				counter -= 1;
+				cpu->iq_valid &= ~(1u << i);
+				cpu->iq_held &= ~(1u << i);
 			}
 		}
-		for(i = INT1; i <= MUL3; i++) {
-			CPU_Stage* stage = &cpu->stage[i];
+		squash_lsq_entries(cpu, iq_entry->thread, bis_index, second_bis_index);
+		squash_parked(cpu, iq_entry->thread, bis_index, second_bis_index);
+		int flushed_thread = iq_entry->thread;
+		// A JUMP issued behind the branch waits in the branch unit's latch
+		for(i = INT1; i <= BRANCH; i++) {
+			CPU_Stage* stage = cpu->latch[i].cur;
 			IQ_ENTRY* iq_entry = &stage->iq_entry;
-			if(iq_entry->bis_index == bis_index || iq_entry->bis_index == second_bis_index) { 
-				strcpy(stage->opcode, "NOP");
+			if(iq_entry->thread == flushed_thread && (iq_entry->bis_index == bis_index || iq_entry->bis_index == second_bis_index)) { 
+				// A latch no instruction ever passed through holds a zeroed entry of thread 0
+				if(iq_entry->stage_finished >= DRF && iq_entry->stage_finished < (iq_entry->fu_type_needed == MUL ? MUL3 : (iq_entry->fu_type_needed == BRANCH ? BRANCH : INT2))) {
+					release_consumers(cpu, iq_entry);
+				}
+				stage->op = OP_NOP;
 				iq_entry->stage_finished = NUM_STAGES;
 			}
 		}
 		int no_of_flushed_ins = 0;
-		int rob_index_of_branch = (&cpu->BIS[iq_entry->bis_index])->rob_index;
-		while(rob_index_of_branch != cpu->rob_tail) {
+		int rob_index_of_branch = (&thread->BIS[iq_entry->bis_index])->rob_index;
+		while(rob_index_of_branch != thread->rob_tail) {
 			no_of_flushed_ins += 1;
 			rob_index_of_branch = (rob_index_of_branch + 1)%ROB_SIZE;
+			count_writers(cpu, thread, rob_index_of_branch, -1);
+			trace_rob_squash(cpu, thread, rob_index_of_branch);
 		}
-		cpu->rob_tail = (&cpu->BIS[iq_entry->bis_index])->rob_index;
-		cpu->rob_current_size -= no_of_flushed_ins;
-		cpu->bis_tail = iq_entry->bis_index;
+		thread->rob_tail = (&thread->BIS[iq_entry->bis_index])->rob_index;
+		thread->rob_current_size -= no_of_flushed_ins;
+		thread->bis_tail = iq_entry->bis_index;
+		// The branch keeps its entry, the ones after it are free again
+		thread->bis_current_size = (thread->bis_tail - thread->bis_head + BIS_SIZE) % BIS_SIZE + 1;
 		for(i = 0; i < ARF_SIZE; i++) {
-			cpu->rename_table[i] = (&cpu->BIS[iq_entry->bis_index])->checkpoint_entry == 1 ? cpu->checkpoint_rename_table_1[i] : cpu->checkpoint_rename_table_2[i];
+			thread->rename_table[i] = (&thread->BIS[iq_entry->bis_index])->checkpoint_entry == 1 ? thread->checkpoint_rename_table_1[i] : thread->checkpoint_rename_table_2[i];
+		}
+		for(i = 0; i < cpu->prf_size; i++) {
+			// Registers another thread allocated since the checkpoint stay as they are
+			if(cpu->phys_reg_owner[i] != iq_entry->thread) {
+				continue;
+			}
+			cpu->free_PR_list[i] = (&thread->BIS[iq_entry->bis_index])->checkpoint_entry == 1 ? thread->free_PR_list_checkpoint_1[i] : thread->free_PR_list_checkpoint_2[i]; 
 		}
-		for(i = 0; i < PRF_SIZE; i++) {
-			cpu->free_PR_list[i] = (&cpu->BIS[iq_entry->bis_index])->checkpoint_entry == 1 ? cpu->free_PR_list_checkpoint_1[i] : cpu->free_PR_list_checkpoint_2[i]; 
+		thread->latest_arithmetic_inst_phys_reg = (&thread->BIS[iq_entry->bis_index])->latest_arithmetic_phys_reg;
+		count_rename_refs(cpu);
+		count_checkpoint_refs(cpu);
+		// The checkpointed free list misses what older instructions freed since
+		for(i = 0; i < cpu->prf_size; i++) {
+			if(cpu->phys_reg_owner[i] == iq_entry->thread) {
+				release_register(cpu, i);
+			}
 		}
 	}
 	
-	CPU_Stage* fetch_stage = &cpu->stage[F];
-	strcpy(fetch_stage->opcode, "NOP");
-	CPU_Stage* decode_stage = &cpu->stage[DRF];
-	strcpy(decode_stage->opcode, "NOP");
-	(&cpu->stage[F])->stalled = (&cpu->stage[DRF])->stalled = 0;
+	squash_front_end_latches(cpu, thread);
+	// A HALT decoded after the flush was requested is younger than the branch and gone too
+	thread->stop_fetch_decode = 0;
 	//For clearing, if instruction is JUMP just compare the pc value and remove everything which has a greater value.
 	//Remove IQ entries using bis_index of the branch iq_entry - whichever is having the same bis_index or the later ones
 	//Same for LSQ entries
@@ -1241,78 +2977,585 @@ int flush(APEX_CPU* cpu, BTB_ENTRY* btb_entry, IQ_ENTRY* iq_entry, int target_ad
 	//Handle jump
 	return 0;
 }
+typedef struct PROFILE_ROW
+{
+	int index;
+	int cost;
+} PROFILE_ROW;
+
+static int
+compare_profile_rows(const void* a, const void* b) {
+	const PROFILE_ROW* row_a = a;
+	const PROFILE_ROW* row_b = b;
+	if(row_a->cost != row_b->cost) {
+		return row_a->cost < row_b->cost ? 1 : -1;
+	}
+	return row_a->index - row_b->index;
+}
+
+/*
+ * Writes code memory annotated with the per-PC counters, most expensive
+ * instruction first. Cost is the number of cycles the instruction spent
+ * as the ROB head, i.e. cycles it held up commit. Covers thread 0's
+ * program, which is the whole run unless SMT is on.
+ */
+int write_pc_profile(APEX_CPU* cpu, const char* filename) {
+  APEX_THREAD* thread = &cpu->threads[0];
+  FILE* fp = fopen(filename, "w");
+  if(!fp) {
+    fprintf(stderr, "APEX_Error : Unable to open profile file %s\n", filename);
+    return 1;
+  }
+  PROFILE_ROW* rows = malloc(sizeof(*rows) * thread->code_memory_size);
+  if(!rows) {
+    fclose(fp);
+    return 1;
+  }
+  for(int index = 0; index < thread->code_memory_size; ++index) {
+    rows[index].index = index;
+    rows[index].cost = thread->pc_profile[index].rob_head_cycles;
+  }
+  qsort(rows, thread->code_memory_size, sizeof(*rows), compare_profile_rows);
+
+  fprintf(fp, "# APEX per-PC profile, %d cycles, %d instructions retired, sorted by ROB head cycles\n", cpu->clock, cpu->ins_completed);
+  fprintf(fp, "%-6s %-6s %-24s %10s %10s %10s %10s %10s %10s\n", "pc", "index", "instruction", "executed", "committed", "rob_head", "iq_wait", "mispred", "lsq_lat");
+  for(int row = 0; row < thread->code_memory_size; ++row) {
+    int index = rows[row].index;
+    PC_PROFILE* profile = &thread->pc_profile[index];
+    char label[16];
+    char text[64];
+    snprintf(label, sizeof(label), "(I%d)", index);
+    format_instruction(text, sizeof(text), &thread->code_memory[index]);
+    fprintf(fp, "%-6d %-6s %-24s %10d %10d %10d %10d %10d %10.1f\n", 4000 + index * 4, label, text,
+            profile->executions, profile->commits, profile->rob_head_cycles, profile->iq_wait_cycles,
+            profile->mispredicts, profile->commits ? (double) profile->lsq_cycles / profile->commits : 0.0);
+  }
+  free(rows);
+  fclose(fp);
+  return 0;
+}
+
 int print_register_state(APEX_CPU* cpu) {
-  printf("=============== STATE OF ARCHITECTURAL REGISTER FILE ==========\n");
-  int index;
-  int no_registers = (int) (sizeof(cpu->regs)/sizeof(cpu->regs[0]));
-  for(index = 0; index < no_registers - 1; ++index) {//Assummin CC register is also part of the register file
-    printf("| \t REG[%d] \t | \t Value=%d \t | \t STATUS=%s \t |\n", index, cpu->regs[index], (cpu->regs_valid[index] ? "VALID" : "INVALID"));
+  for(int t = 0; t < cpu->num_threads; ++t) {
+    APEX_THREAD* thread = &cpu->threads[t];
+    if(cpu->num_threads > 1) {
+      printf("=============== STATE OF ARCHITECTURAL REGISTER FILE, THREAD %d ==========\n", t);
+    } else {
+      printf("=============== STATE OF ARCHITECTURAL REGISTER FILE ==========\n");
+    }
+    int index;
+    int no_registers = (int) (sizeof(thread->regs)/sizeof(thread->regs[0]));
+    for(index = 0; index < no_registers - 1; ++index) {//Assummin CC register is also part of the register file
+      printf("| \t REG[%d] \t | \t Value=%d \t | \t STATUS=%s \t |\n", index, thread->regs[index], (thread->regs_valid[index] ? "VALID" : "INVALID"));
+    }
   }
   return 0;
 }
 
 int print_data_memory(APEX_CPU* cpu) {
+  return print_memory(&cpu->data_memory);
+}
+
+int print_memory(APEX_MEMORY* memory) {
   printf("============== STATE OF DATA MEMORY =============\n");
-  int index;
-  for(index = 0; index < 4000; ++index) {
-	  if(cpu->data_memory[index] != 0) {
-    		printf("| \t MEM[%d] \t | \t Data Value=%d \t |\n", index, cpu->data_memory[index]);
-	  }
+  // Only pages that were stored to can differ from the initial image
+  mem_sort_dirty_pages(memory);
+  for(int page = 0; page < memory->dirty_count; ++page) {
+    uint32_t page_number = memory->dirty_pages[page];
+    int* words = mem_page_words(memory, page_number);
+    for(uint32_t index = 0; index < MEM_PAGE_WORDS; ++index) {
+      if(words[index] != 0) {
+        printf("| \t MEM[%u] \t | \t Data Value=%d \t |\n", (page_number << MEM_PAGE_BITS) | index, words[index]);
+      }
+    }
   }
   return 0;
 }
+/* format_instruction for a dynamic PC that may not be valid */
+static void
+describe_pc(APEX_THREAD* thread, int pc, char* buffer, size_t size) {
+	int index = get_code_index(pc);
+	if(pc >= 4000 && index < thread->code_memory_size) {
+		format_instruction(buffer, size, &thread->code_memory[index]);
+	} else {
+		snprintf(buffer, size, "?");
+	}
+}
+
 /*
- *  APEX CPU simulation loop
+ * What the watchdog prints when nothing has committed for a while: the
+ * ROB head, every occupied IQ entry with its operand tags and the
+ * occupied LSQ entries from the head, which is usually enough to see
+ * who waits on whom.
+ */
+int print_watchdog_snapshot(APEX_CPU* cpu, FILE* fp) {
+  char text[64];
+  int rob_size = 0;
+  for(int t = 0; t < cpu->num_threads; t++) {
+    rob_size += cpu->threads[t].rob_current_size;
+  }
+  fprintf(fp, "============== WATCHDOG SNAPSHOT =============\n");
+  fprintf(fp, "| \t Cycle=%d \t | \t Last commit=%d \t | \t ROB size=%d \t | \t LSQ size=%d \t |\n", cpu->clock,
+          cpu->last_commit_clock, rob_size, cpu->lsq_current_size);
+  for(int t = 0; t < cpu->num_threads; t++) {
+    APEX_THREAD* thread = &cpu->threads[t];
+    if(cpu->num_threads > 1) {
+      fprintf(fp, "| \t THREAD %d%s \t ", t, thread->halted ? " halted" : "");
+    }
+    // A drained ROB keeps its head index, where the next entry goes
+    if(thread->rob_current_size == 0) {
+      fprintf(fp, "| \t ROB empty \t |\n");
+    } else {
+      ROB_ENTRY* head = &thread->ROB[thread->rob_head];
+      describe_pc(thread, head->pc_value, text, sizeof(text));
+      fprintf(fp, "| \t ROB[%d] head \t | \t pc(%d) %s \t | \t result_valid=%d \t | \t dest P%d \t |\n", thread->rob_head,
+              head->pc_value, text, (thread->rob_done >> thread->rob_head) & 1, head->phys_register);
+    }
+  }
+  for(int i = 0; i < IQ_SIZE; i++) {
+    if(!(cpu->iq_valid & (1u << i))) {
+      continue;
+    }
+    IQ_ENTRY* entry = &cpu->IQ[i];
+    describe_pc(&cpu->threads[entry->thread], entry->pc_value, text, sizeof(text));
+    fprintf(fp, "| \t IQ[%d] \t | \t pc(%d) %s \t | \t ROB[%d] \t | \t src1 P%d ready=%d \t | \t src2 P%d ready=%d \t |\n", i,
+            entry->pc_value, text, entry->rob_index, entry->src1_tag, (cpu->iq_src1_ready >> i) & 1, entry->src2_tag,
+            (cpu->iq_src2_ready >> i) & 1);
+  }
+  // head and tail stay put when the LSQ drains, only the size says what is live
+  for(int n = 0; n < cpu->lsq_current_size; n++) {
+    int i = (cpu->lsq_head + n) % LSQ_SIZE;
+    LSQ_ENTRY* entry = &cpu->LSQ[i];
+    describe_pc(&cpu->threads[cpu->lsq_thread[i]], entry->pc, text, sizeof(text));
+    fprintf(fp, "| \t LSQ[%d] \t | \t pc(%d) %s \t | \t ROB[%d] \t | \t address_valid=%d \t | \t data_valid=%d \t | \t cycles=%d \t |\n", i,
+            entry->pc, text, cpu->lsq_rob_index[i], entry->address_valid, entry->ins_type == 0 || entry->src1_valid,
+            entry->cycle_counter);
+  }
+  return 0;
+}
+
+/* Returns 1 if the instruction at thread's ROB head still sits in the IQ */
+static int
+rob_head_in_iq(APEX_CPU* cpu, int thread_id) {
+	APEX_THREAD* thread = &cpu->threads[thread_id];
+	for(int i = 0; i < IQ_SIZE; i++) {
+		if((cpu->iq_valid & (1u << i)) && cpu->iq_thread[i] == thread_id && cpu->IQ[i].rob_index == thread->rob_head) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * Charges the cycle that just finished to exactly one CPI stack bucket.
+ * A cycle without a commit is blamed on whatever holds up the ROB head,
+ * or on the front end when the ROB is empty. With SMT the blame goes to
+ * the lowest numbered thread that has not halted.
+ */
+static void
+account_cycle(APEX_CPU* cpu, int committed) {
+	int thread_id = 0;
+	while(thread_id < cpu->num_threads - 1 && cpu->threads[thread_id].halted) {
+		thread_id++;
+	}
+	APEX_THREAD* thread = &cpu->threads[thread_id];
+	int cause;
+	if(committed) {
+		cause = CYCLE_COMMIT;
+	} else if(thread->rob_current_size == 0) {
+		cause = thread->recovery_pending ? CYCLE_BRANCH_RECOVERY : CYCLE_FRONTEND;
+	} else {
+		ROB_ENTRY* rob_entry = &thread->ROB[thread->rob_head];
+		int op = rob_entry->op;
+		if(op == OP_LOAD || op == OP_LDR || op == OP_STORE || op == OP_STR || op == OP_VLOAD || op == OP_VSTORE) {
+			LSQ_ENTRY* lsq_entry = cpu->lsq_head > -1 ? &cpu->LSQ[cpu->lsq_head] : NULL;
+			if(lsq_entry && cpu->lsq_thread[cpu->lsq_head] == thread_id && cpu->lsq_rob_index[cpu->lsq_head] == thread->rob_head && lsq_entry->address_valid == 1) {
+				// A store whose data is not forwarded yet is still waiting on wakeup
+				cause = (lsq_entry->ins_type == 0 || store_data_ready(cpu, lsq_entry)) ? CYCLE_MEMORY : CYCLE_IQ_WAKEUP;
+			} else {
+				cause = rob_head_in_iq(cpu, thread_id) ? CYCLE_IQ_WAKEUP : CYCLE_INT_PIPE;
+			}
+		} else if(rob_head_in_iq(cpu, thread_id)) {
+			cause = CYCLE_IQ_WAKEUP;
+		} else if(machine_timing(&cpu->machine, opcode_names[op]) && machine_timing(&cpu->machine, opcode_names[op])->unit == UNIT_MUL) {
+			cause = CYCLE_MUL_PIPE;
+		} else {
+			cause = CYCLE_INT_PIPE;
+		}
+	}
+	cpu->cycle_stack[cause] += 1;
+}
+
+static const char* cycle_cause_names[NUM_CYCLE_CAUSES] = {
+	"COMMIT", "FRONTEND", "BRANCH_RECOVERY", "IQ_WAKEUP", "INT_PIPE", "MUL_PIPE", "MEMORY"
+};
+
+const char* cycle_cause_name(int cause) {
+  return cycle_cause_names[cause];
+}
+
+int print_cpi_stack(APEX_CPU* cpu) {
+  printf("============== CPI STACK =============\n");
+  printf("| \t Cycles=%d \t | \t Retired=%d \t | \t CPI=%.3f \t |\n", cpu->clock, cpu->ins_completed,
+         cpu->ins_completed ? (double) cpu->clock / cpu->ins_completed : 0.0);
+  for(int index = 0; index < NUM_CYCLE_CAUSES; ++index) {
+    printf("| \t %-16s \t | \t Cycles=%d \t | \t CPI=%.3f \t | \t %5.1f%% \t |\n", cycle_cause_names[index], cpu->cycle_stack[index],
+           cpu->ins_completed ? (double) cpu->cycle_stack[index] / cpu->ins_completed : 0.0,
+           cpu->clock ? 100.0 * cpu->cycle_stack[index] / cpu->clock : 0.0);
+  }
+  return 0;
+}
+
+/* How much of what fetch handed to decode came from the loop stream buffer, nothing with it off */
+int print_loop_buffer_stats(APEX_CPU* cpu) {
+  if(!cpu->loop_buffer_enabled) {
+    return 0;
+  }
+  printf("============== LOOP STREAM BUFFER =============\n");
+  printf("| \t Loops=%d \t | \t Streamed=%d \t | \t Fetched=%d \t | \t Coverage=%.1f%% \t |\n",
+         cpu->loops_streamed, cpu->streamed_instructions, cpu->next_seq,
+         cpu->next_seq ? 100.0 * cpu->streamed_instructions / cpu->next_seq : 0.0);
+  return 0;
+}
+
+/* Instruction pairs decode fused into one micro-op, nothing with fusion off */
+int print_fusion_stats(APEX_CPU* cpu) {
+  if(!cpu->fusion_enabled) {
+    return 0;
+  }
+  int fused = 2 * (cpu->fused_branches + cpu->fused_movcs);
+  printf("============== MACRO-OP FUSION =============\n");
+  printf("| \t Branch pairs=%d \t | \t MOVC pairs=%d \t | \t Fetched=%d \t | \t Fused=%.1f%% \t |\n",
+         cpu->fused_branches, cpu->fused_movcs, cpu->next_seq, cpu->next_seq ? 100.0 * fused / cpu->next_seq : 0.0);
+  return 0;
+}
+
+/* Instructions rename completed without an FU, nothing with move elimination off */
+int print_move_elimination_stats(APEX_CPU* cpu) {
+  if(!cpu->move_elimination_enabled) {
+    return 0;
+  }
+  int eliminated = cpu->eliminated_moves + cpu->eliminated_zeros;
+  printf("============== MOVE ELIMINATION =============\n");
+  printf("| \t Moves=%d \t | \t Zero idioms=%d \t | \t Fetched=%d \t | \t Eliminated=%.1f%% \t |\n",
+         cpu->eliminated_moves, cpu->eliminated_zeros, cpu->next_seq, cpu->next_seq ? 100.0 * eliminated / cpu->next_seq : 0.0);
+  return 0;
+}
+
+/* Loads the value predictor covered and how often it was right, nothing with it off */
+int print_value_prediction_stats(APEX_CPU* cpu) {
+  if(!cpu->value_prediction_enabled) {
+    return 0;
+  }
+  printf("============== LOAD VALUE PREDICTION =============\n");
+  printf("| \t Loads=%d \t | \t Predicted=%d \t | \t Correct=%d \t | \t Coverage=%.1f%% \t | \t Accuracy=%.1f%% \t |\n",
+         cpu->lvp_loads, cpu->lvp_predicted, cpu->lvp_correct,
+         cpu->lvp_loads ? 100.0 * cpu->lvp_predicted / cpu->lvp_loads : 0.0,
+         cpu->lvp_predicted ? 100.0 * cpu->lvp_correct / cpu->lvp_predicted : 0.0);
+  return 0;
+}
+
+/* Loads whose dependents were woken at the hit latency and what the misses cost, nothing with it off */
+int print_load_speculation_stats(APEX_CPU* cpu) {
+  if(!cpu->load_speculation_enabled) {
+    return 0;
+  }
+  printf("============== LOAD HIT SPECULATION =============\n");
+  printf("| \t Loads=%d \t | \t Replays=%d \t | \t Early issues=%d \t | \t Wasted issues=%d \t | \t Hit rate=%.1f%% \t |\n",
+         cpu->spec_loads, cpu->spec_replays, cpu->spec_early_issues, cpu->spec_wasted_issues,
+         cpu->spec_loads ? 100.0 * (cpu->spec_loads - cpu->spec_replays) / cpu->spec_loads : 0.0);
+  return 0;
+}
+
+/* I-cache and FTQ counters of the decoupled front end, nothing without one */
+int print_frontend_stats(APEX_CPU* cpu) {
+  ICACHE* icache = cpu->icache;
+  if(!icache) {
+    return 0;
+  }
+  ICACHE_STATS* stats = &icache->stats;
+  int accesses = stats->hits + stats->misses;
+  printf("============== FRONT END =============\n");
+  printf("| \t I-CACHE \t | \t Sets=%d \t | \t Ways=%d \t | \t Line=%d \t | \t Miss latency=%d \t |\n",
+         icache->config.sets, icache->config.ways, icache->config.line_words, icache->config.miss_latency);
+  printf("| \t Hits=%d \t | \t Misses=%d \t | \t Hit rate=%.1f%% \t | \t Stall cycles=%d \t |\n",
+         stats->hits, stats->misses, accesses ? 100.0 * stats->hits / accesses : 0.0, stats->stall_cycles);
+  printf("| \t Prefetches=%d \t | \t Useful=%d \t | \t Late=%d \t |\n",
+         stats->prefetches, stats->useful_prefetches, stats->late_prefetches);
+  printf("| \t FTQ blocks=%d \t | \t Fetch buffer empty=%d \t |\n", cpu->ftq_blocks, cpu->fetch_buffer_empty_cycles);
+  return 0;
+}
+/*
+ * Per thread IPC of an SMT run against alone_ipc, each program's IPC
+ * running by itself. Progress is the ratio of the two; STP sums it, ANTT
+ * averages its inverse and fairness is the slowest over the fastest.
+ */
+int print_thread_stats(APEX_CPU* cpu, const double* alone_ipc) {
+  double stp = 0.0;
+  double antt = 0.0;
+  double min_progress = 0.0;
+  double max_progress = 0.0;
+  printf("============== SMT THREADS =============\n");
+  for(int t = 0; t < cpu->num_threads; ++t) {
+    APEX_THREAD* thread = &cpu->threads[t];
+    int cycles = thread->halted ? thread->halt_clock : cpu->clock;
+    double ipc = cycles ? (double) thread->ins_completed / cycles : 0.0;
+    double progress = alone_ipc[t] > 0 ? ipc / alone_ipc[t] : 0.0;
+    printf("| \t THREAD[%d] \t | \t Cycles=%d \t | \t Retired=%d \t | \t IPC=%.3f \t | \t Alone IPC=%.3f \t | \t Progress=%.3f \t | \t %s \t |\n",
+           t, cycles, thread->ins_completed, ipc, alone_ipc[t], progress, thread->halted ? "HALTED" : "RUNNING");
+    stp += progress;
+    antt += progress > 0 ? 1.0 / progress : 0.0;
+    min_progress = (t == 0 || progress < min_progress) ? progress : min_progress;
+    max_progress = (t == 0 || progress > max_progress) ? progress : max_progress;
+  }
+  printf("| \t SMT \t | \t Policy=%s \t | \t IPC=%.3f \t | \t STP=%.3f \t | \t ANTT=%.3f \t | \t Fairness=%.3f \t |\n",
+         cpu->fetch_policy == FETCH_ICOUNT ? "ICOUNT" : "ROUND_ROBIN",
+         cpu->clock ? (double) cpu->ins_completed / cpu->clock : 0.0, stp, antt / cpu->num_threads,
+         max_progress > 0 ? min_progress / max_progress : 0.0);
+  return 0;
+}
+
+/*
+ * Starts streaming one CSV record every interval_length cycles to filename.
+ * Records go through a large stdio buffer, so nothing but the current
+ * interval's counters is kept in memory.
+ */
+int open_interval_stats(APEX_CPU* cpu, const char* filename, int interval_length) {
+	if(interval_length <= 0) {
+		fprintf(stderr, "APEX_Error : Interval length must be positive\n");
+		return 1;
+	}
+	cpu->interval_fp = fopen(filename, "w");
+	if(!cpu->interval_fp) {
+		fprintf(stderr, "APEX_Error : Unable to open interval file %s\n", filename);
+		return 1;
+	}
+	cpu->interval_buffer = malloc(1 << 16);
+	if(cpu->interval_buffer) {
+		setvbuf(cpu->interval_fp, cpu->interval_buffer, _IOFBF, 1 << 16);
+	}
+	cpu->interval_length = interval_length;
+	memset(&cpu->interval, 0, sizeof(cpu->interval));
+	fprintf(cpu->interval_fp, "cycle,cycles,retired,ipc,mispredicts");
+	for(int i = 0; i < NUM_CYCLE_CAUSES; i++) {
+		fprintf(cpu->interval_fp, ",%s", cycle_cause_names[i]);
+	}
+	fprintf(cpu->interval_fp, ",rob_occupancy,iq_occupancy,lsq_occupancy\n");
+	return 0;
+}
+
+/* Writes the record for the interval ending at the current clock and starts the next one */
+static void
+write_interval(APEX_CPU* cpu) {
+	INTERVAL_STATS* interval = &cpu->interval;
+	int cycles = cpu->clock - interval->clock;
+	int retired = cpu->ins_completed - interval->ins_completed;
+	if(cycles <= 0) {
+		return;
+	}
+	fprintf(cpu->interval_fp, "%d,%d,%d,%.3f,%d", cpu->clock, cycles, retired, (double) retired / cycles,
+			cpu->branch_mispredicts - interval->branch_mispredicts);
+	for(int i = 0; i < NUM_CYCLE_CAUSES; i++) {
+		fprintf(cpu->interval_fp, ",%d", cpu->cycle_stack[i] - interval->cycle_stack[i]);
+	}
+	fprintf(cpu->interval_fp, ",%.2f,%.2f,%.2f\n", (double) interval->rob_occupancy / cycles,
+			(double) interval->iq_occupancy / cycles, (double) interval->lsq_occupancy / cycles);
+
+	interval->clock = cpu->clock;
+	interval->ins_completed = cpu->ins_completed;
+	interval->branch_mispredicts = cpu->branch_mispredicts;
+	memcpy(interval->cycle_stack, cpu->cycle_stack, sizeof(interval->cycle_stack));
+	interval->rob_occupancy = interval->iq_occupancy = interval->lsq_occupancy = 0;
+}
+
+/* Called once per cycle, after cpu->clock has advanced */
+static void
+sample_interval(APEX_CPU* cpu) {
+	INTERVAL_STATS* interval = &cpu->interval;
+	for(int t = 0; t < cpu->num_threads; t++) {
+		interval->rob_occupancy += cpu->threads[t].rob_current_size;
+	}
+	interval->lsq_occupancy += cpu->lsq_current_size;
+	interval->iq_occupancy += __builtin_popcount(cpu->iq_valid);
+	if(cpu->clock - interval->clock >= cpu->interval_length) {
+		write_interval(cpu);
+	}
+}
+
+/* ICOUNT: instructions of thread waiting in the decode latch or the IQ */
+static int
+front_end_count(APEX_CPU* cpu, int thread_id) {
+	APEX_THREAD* thread = &cpu->threads[thread_id];
+	int count = thread->latch[DRF].cur->seq > thread->last_dispatched_seq;
+	for(uint32_t occupied = cpu->iq_valid; occupied; occupied &= occupied - 1) {
+		count += cpu->iq_thread[__builtin_ctz(occupied)] == thread_id;
+	}
+	return count;
+}
+
+/*
+ * Picks the thread fetch and decode work on this cycle. Threads that have
+ * halted or dispatched HALT are passed over. Round robin takes the next
+ * one in turn, ICOUNT the one with the fewest instructions in decode and
+ * the IQ, ties going round robin.
+ */
+static int
+select_front_end_thread(APEX_CPU* cpu) {
+	if(cpu->num_threads == 1) {
+		return 0;
+	}
+	int selected = -1;
+	int selected_count = IQ_SIZE + 2;
+	for(int k = 0; k < cpu->num_threads; k++) {
+		int t = (cpu->next_fetch_thread + k) % cpu->num_threads;
+		APEX_THREAD* thread = &cpu->threads[t];
+		if(thread->halted || thread->stop_fetch_decode) {
+			continue;
+		}
+		if(cpu->fetch_policy == FETCH_ROUND_ROBIN) {
+			selected = t;
+			break;
+		}
+		int count = front_end_count(cpu, t);
+		if(count < selected_count) {
+			selected = t;
+			selected_count = count;
+		}
+	}
+	if(selected < 0) {
+		selected = cpu->next_fetch_thread;
+	}
+	cpu->next_fetch_thread = (selected + 1) % cpu->num_threads;
+	return selected;
+}
+
+/*
+ * Advances the pipeline by one clock cycle. Returns 1 once HALT has
+ * committed, counting the cycle it committed in but none after it.
+ */
+int APEX_cpu_cycle(APEX_CPU *cpu)
+{
+	if (cpu->halted) {
+		return 1;
+	}
+	if (LOG_ENABLED(LOG_CPU, LOG_DEBUG))
+	{
+		log_printf("^^^^^^^^^^^^^^^^^^^^^^^^^^^^ CLOCK CYCLE %d ^^^^^^^^^^^^^^^^^^^^^^^^^^^\n", cpu->clock);
+	}
+	//NOTE: Need to rewrite this.
+	// memory(cpu);
+	//fprintf(stderr, "Test APEX 1");
+	int retired_before = cpu->ins_completed;
+	// Every thread retires from its own ROB partition
+	int running = 0;
+	for(int t = 0; t < cpu->num_threads; t++) {
+		APEX_THREAD* thread = &cpu->threads[t];
+		if(thread->halted) {
+			continue;
+		}
+		STAGE_TIMED(&cpu->stage_profile, PROF_RETIRE, thread->halted = instruction_retirement(cpu, thread));
+		if(thread->halted) {
+			thread->halt_clock = cpu->clock;
+		} else {
+			running = 1;
+		}
+	}
+	if(!running) {
+		// The HALT cycle is charged like any other, so the CPI stack adds up to every commit
+		account_cycle(cpu, 1);
+		cpu->clock++;
+		if(cpu->interval_fp) {
+			sample_interval(cpu);
+		}
+		cpu->halted = 1;
+		return 1;
+	}
+	//fprintf(stderr, "Test APEX 2");
+	// Stages only read their own cur latch and the held flags of the last edge.
+	// The order still matters for the shared IQ, ROB, LSQ and registers: results
+	// wake the IQ before issue selects, and decode inserts after issue.
+	STAGE_TIMED(&cpu->stage_profile, PROF_MEMORY, memory_issue(cpu));
+	//fprintf(stderr, "Test APEX 3");
+	STAGE_TIMED(&cpu->stage_profile, PROF_BRANCH, branch_fu(cpu));
+	//fprintf(stderr, "Test APEX 4");
+	STAGE_TIMED(&cpu->stage_profile, PROF_WRITE_LSQ, writeToLSQ(cpu));
+	//fprintf(stderr, "Test APEX 5");
+	STAGE_TIMED(&cpu->stage_profile, PROF_MUL3, mul_fu_3(cpu));
+	//fprintf(stderr, "Test APEX 6");
+	STAGE_TIMED(&cpu->stage_profile, PROF_MUL2, mul_fu_2(cpu));
+	//fprintf(stderr, "Test APEX 7");
+	STAGE_TIMED(&cpu->stage_profile, PROF_MUL1, mul_fu_1(cpu));
+	//fprintf(stderr, "Test APEX 8");
+	STAGE_TIMED(&cpu->stage_profile, PROF_INT2, int_fu_2(cpu));
+	//fprintf(stderr, "Test APEX 9");
+	STAGE_TIMED(&cpu->stage_profile, PROF_INT1, int_fu_1(cpu));
+	//fprintf(stderr, "Test APEX 10");
+	STAGE_TIMED(&cpu->stage_profile, PROF_ISSUE, issue_queue(cpu));
+	//fprintf(stderr, "Test APEX 11");
+	cpu->front_end_thread = select_front_end_thread(cpu);
+	STAGE_TIMED(&cpu->stage_profile, PROF_DECODE, decode(cpu));
+	//fprintf(stderr, "Test APEX 12\n");
+	STAGE_TIMED(&cpu->stage_profile, PROF_FETCH, fetch(cpu));
+	latch_clock(cpu->latch, NUM_STAGES);
+	for(int i = 0; i < cpu->num_threads; i++) {
+		latch_clock(cpu->threads[i].latch, DRF + 1);
+	}
+	for(int t = 0; t < cpu->num_threads; t++) {
+		APEX_THREAD* thread = &cpu->threads[t];
+		if(thread->flush_and_reload) {
+			thread->flush_and_reload = 0;
+			STAGE_TIMED(&cpu->stage_profile, PROF_FLUSH, flush(cpu, thread->mispredicted_branch_btb_entry, thread->mispredicted_branch_iq_entry, thread->mispredicted_branch_target_address_new));
+		}
+	}
+	account_cycle(cpu, cpu->ins_completed != retired_before);
+	cpu->clock++;
+	if(cpu->interval_fp) {
+		sample_interval(cpu);
+	}
+	return 0;
+}
+
+/*
+ *  APEX CPU simulation loop, runs until HALT commits or no_of_cycles.
+ *  Returns 1 if the watchdog stopped a run that was no longer committing.
  *
  *  Note : You are free to edit this function according to your
  * 				 implementation
  */
 int APEX_cpu_run(APEX_CPU *cpu, int no_of_cycles, int flag)
 {
-	ENABLE_DEBUG_MESSAGES = flag;
+	if (flag) {
+		log_set_all_levels(LOG_DEBUG);
+	}
+	int stuck = 0;
 	while (cpu->clock < no_of_cycles)
 	{
-		if (ENABLE_DEBUG_MESSAGES)
-		{
-			printf("^^^^^^^^^^^^^^^^^^^^^^^^^^^^ CLOCK CYCLE %d ^^^^^^^^^^^^^^^^^^^^^^^^^^^\n", cpu->clock);
-		}
-		//NOTE: Need to rewrite this.
-		// memory(cpu);
-		//fprintf(stderr, "Test APEX 1");
-		int is_halt = instruction_retirement(cpu);
-		if(is_halt) {
+		if (APEX_cpu_cycle(cpu)) {
 			break;
 		}
-		//fprintf(stderr, "Test APEX 2");
-		memory_issue(cpu);
-		//fprintf(stderr, "Test APEX 3");
-		branch_fu(cpu);
-		//fprintf(stderr, "Test APEX 4");
-		writeToLSQ(cpu);
-		//fprintf(stderr, "Test APEX 5");
-		mul_fu_3(cpu);
-		//fprintf(stderr, "Test APEX 6");
-		mul_fu_2(cpu);
-		//fprintf(stderr, "Test APEX 7");
-		mul_fu_1(cpu);
-		//fprintf(stderr, "Test APEX 8");
-		int_fu_2(cpu);
-		//fprintf(stderr, "Test APEX 9");
-		int_fu_1(cpu);
-		//fprintf(stderr, "Test APEX 10");
-		issue_queue(cpu);
-		//fprintf(stderr, "Test APEX 11");
-		decode(cpu);
-		//fprintf(stderr, "Test APEX 12\n");
-		fetch(cpu);
-		if(flush_and_reload) {
-			flush_and_reload = 0;
-			flush(cpu, mispredicted_branch_btb_entry, mispredicted_branch_iq_entry, mispredicted_branch_target_address_new);
+		if (cpu->watchdog_cycles && cpu->clock - cpu->last_commit_clock >= cpu->watchdog_cycles) {
+			fprintf(stderr, "APEX_Error : Nothing committed for %d cycles, stopping at cycle %d\n",
+				cpu->watchdog_cycles, cpu->clock);
+			print_watchdog_snapshot(cpu, stderr);
+			stuck = 1;
+			break;
 		}
-		cpu->clock++;
+	}
+	if(cpu->interval_fp) {
+		// Partial last interval
+		write_interval(cpu);
+		fflush(cpu->interval_fp);
 	}
 	printf("(apex) >> Simulation Complete\n");
   	print_register_state(cpu);
   	print_data_memory(cpu);
-	return 0;
+	print_cpi_stack(cpu);
+	print_frontend_stats(cpu);
+	print_loop_buffer_stats(cpu);
+	print_fusion_stats(cpu);
+	print_move_elimination_stats(cpu);
+	print_value_prediction_stats(cpu);
+	print_load_speculation_stats(cpu);
+	print_stage_profile(&cpu->stage_profile);
+	return stuck;
 }
@@ -1,5 +1,18 @@
 #ifndef _APEX_CPU_H_
 #define _APEX_CPU_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "apex.h"
+#include "coherence.h"
+#include "icache.h"
+#include "machine.h"
+#include "memory.h"
+#include "prefetch.h"
+#include "simd.h"
+#include "stage_profile.h"
+#include "trace.h"
 /**
  *  cpu.h
  *  Contains various CPU and Pipeline Data structures
@@ -31,10 +44,76 @@ enum FU
 	BN_Z
 };
 
+/* Causes a cycle is charged to in the CPI stack. Every simulated cycle
+ * lands in exactly one bucket, so the buckets add up to cpu->clock.
+ */
+enum CYCLE_CAUSE
+{
+	CYCLE_COMMIT,		// ROB head retired this cycle
+	CYCLE_FRONTEND,		// ROB empty, fetch/decode starved or stalled
+	CYCLE_BRANCH_RECOVERY,	// ROB empty, refilling after a flush
+	CYCLE_IQ_WAKEUP,	// ROB head waiting in the IQ for its operands
+	CYCLE_INT_PIPE,		// ROB head in INT1/INT2 or the branch unit
+	CYCLE_MUL_PIPE,		// ROB head in MUL1-MUL3
+	CYCLE_MEMORY,		// ROB head in memory_issue's 3 cycle access
+	NUM_CYCLE_CAUSES
+};
+
+/* Instruction decode fused into the one before or after it */
+enum FUSION
+{
+	FUSED_NONE,
+	FUSED_BZ,		// BZ after the ADD/ADDL/SUB/SUBL setting its flag
+	FUSED_BNZ,		// BNZ after the ADD/ADDL/SUB/SUBL setting its flag
+	FUSED_MOVC		// MOVC before the ALU instruction reading its result
+};
+
+/*
+ * Opcode, decoded from its name once as the program is loaded so the
+ * pipeline compares numbers. VADD to VAND follow enum SIMD_OP.
+ */
+enum OPCODE
+{
+	OP_EMPTY,		// Latch no instruction went through, or a name no instruction has
+	OP_NOP,			// Squashed out of its latch
+	OP_MOVC,
+	OP_ADD,
+	OP_ADDL,
+	OP_SUB,
+	OP_SUBL,
+	OP_MUL,
+	OP_AND,
+	OP_OR,
+	OP_EXOR,
+	OP_LOAD,
+	OP_LDR,
+	OP_STORE,
+	OP_STR,
+	OP_BZ,
+	OP_BNZ,
+	OP_JUMP,
+	OP_HALT,
+	OP_VADD,
+	OP_VSUB,
+	OP_VMUL,
+	OP_VAND,
+	OP_VLOAD,
+	OP_VSTORE,
+	NUM_OPCODES
+};
+
+/* Lane operation of a VADD/VSUB/VMUL/VAND, -1 for any other opcode */
+static inline int
+vector_alu_op(int op)
+{
+	return op >= OP_VADD && op <= OP_VAND ? op - OP_VADD + SIMD_ADD : -1;
+}
+
 /* Format of an APEX instruction  */
 typedef struct APEX_Instruction
 {
 	char opcode[128];	// Operation Code
+	uint8_t op;		// enum OPCODE of opcode
 	int rd;		    // Destination Register Address
 	int rs1;		    // Source-1 Register Address
 	int rs2;			//// Source-2 Register Address
@@ -43,16 +122,26 @@ typedef struct APEX_Instruction
 	int stage_finished;
 } APEX_Instruction;
 
-/* Format of an ROB ENTRY  */
+/* Format of an ROB ENTRY, fields sized to the ARF, PRF and opcodes they hold  */
 typedef struct ROB_ENTRY
 {
 	int pc_value; //Address of the instruction
-	int arch_register; //where to store the pc_value
 	int result; //result
-	int exception_codes;
-	int result_valid;
-	char instruction_type[128];
-	int phys_register;
+	uint8_t op;		// enum OPCODE
+	int8_t arch_register; //where to store the pc_value
+	int8_t phys_register;
+	uint8_t exception_codes;
+	/* Other half of a fused micro-op, see enum FUSION */
+	uint8_t fused;
+	int8_t fused_arch_register;	// MOVC destination
+	int8_t fused_phys_register;
+	int fused_result;		// MOVC literal
+	int fused_pc;
+	int fused_seq;
+	/* Vector destination, VLEN lanes from arch_register on, 0 for a scalar result */
+	uint8_t lanes;
+	int8_t lane_phys_registers[VLEN];
+	int lane_results[VLEN];
 } ROB_ENTRY;
 
 typedef struct BIS_ENTRY
@@ -60,6 +149,7 @@ typedef struct BIS_ENTRY
 	int pc_value;
 	int rob_index;
 	int checkpoint_entry;
+	int latest_arithmetic_phys_reg; // Whose flag a BZ/BNZ after a flush of this branch reads
 } BIS_ENTRY;
 
 typedef struct BTB_ENTRY
@@ -69,19 +159,76 @@ typedef struct BTB_ENTRY
 	int history_bit;//for prediction
 } BTB_ENTRY;
 
+/* Longest loop body, branch included, the loop stream buffer holds */
+#define LOOP_BUFFER_SIZE 16
+/* Taken iterations of a loop branch fetch sees before streaming its body */
+#define LOOP_DETECT_ITERATIONS 2
+
+/*
+ * Loop stream buffer: the body of a tight loop, straight line code
+ * closed by a backward BZ/BNZ, which fetch replays to decode without
+ * reading code memory or the BTB until a flush.
+ */
+typedef struct LOOP_BUFFER
+{
+	APEX_Instruction* body[LOOP_BUFFER_SIZE];	// Loop branch last
+	int start_pc;
+	int length;
+	int next;		// Index of the instruction streamed next
+	int streaming;
+	int candidate_pc;	// Backward branch fetch last predicted taken
+	int iterations;		// How often it was
+} LOOP_BUFFER;
+
+/* Load value predictor entries per thread, indexed by PC */
+#define LVP_SIZE 16
+/* Confidence a load value predictor entry needs to predict, the counter saturates there */
+#define LVP_CONFIDENT 3
+
+/*
+ * Load value predictor entry: the value the load at pc read last and
+ * how many times in a row it read the same one.
+ */
+typedef struct LVP_ENTRY
+{
+	int pc;
+	int value;
+	int confidence;
+} LVP_ENTRY;
+
+/* Fetch target queue blocks and fetched instructions a thread can hold ahead of decode */
+#define FTQ_SIZE 8
+#define FETCH_BUFFER_SIZE 8
+
+/*
+ * Sequential run of instructions the branch predictor expects to execute,
+ * ending at the end of an I-cache line or at a branch it predicts taken.
+ */
+typedef struct FETCH_BLOCK
+{
+	int pc;		// Next instruction of the block to fetch
+	int count;	// Instructions left to fetch
+} FETCH_BLOCK;
+
 typedef struct LSQ_ENTRY
 {
 	int value;
-	int src1_tag;
-	int src1_valid;
-	int load_dest_reg;
 	int calculated_mem_address;
-	int address_valid;
-	int ins_type;
-	int rob_index;//rob_index
-	int cycle_counter;
 	int pc;
-	int bis_index;
+	int dispatch_cycle;
+	int l1_wait;		// Cycles of miss or transfer penalty left
+	int src1_valid;		// Copied from phys_regs_valid, so not just 0/1
+	int8_t src1_tag;
+	int8_t load_dest_reg;
+	uint8_t address_valid;
+	uint8_t ins_type;
+	uint8_t cycle_counter;
+	uint8_t access_cycles;	// cycle_counter value the access completes at
+	uint8_t l1_accessed;	// Coherence transaction done, multi-core only
+	uint8_t value_predicted;	// Load whose dependents got value as its result at dispatch
+	/* VLOAD destinations or VSTORE data of the VLEN words from the address, 0 for a scalar access */
+	uint8_t lanes;
+	int8_t lane_tags[VLEN];
 } LSQ_ENTRY;
 
 typedef struct IQ_ENTRY
@@ -94,22 +241,60 @@ typedef struct IQ_ENTRY
 	int des_physical_reg;
 	int src2_value;
 	int src2_tag;
-	int src2_ready;
 	int src1_value;
 	int src1_tag;
-	int src1_ready;
 	int literal;
 	int fu_type_needed;
-	char opcode[128];
+	uint8_t op;		// enum OPCODE
 	int stage_finished;
 	int pc_value;
+	int seq;
+	int thread;		// Owning hardware thread
+	int spec_load;		// Speculative wakeup that made a source ready (spec_epoch), 0 for none
+	/* Second instruction of a fused micro-op, see enum FUSION */
+	int fused;
+	int fused_pc;
+	int fused_literal;
+	int fused_seq;
+	/* From the machine description */
+	int extra_latency;	// Cycles past the unit's last stage before the result
+	int issue_interval;	// Cycles before the unit takes the next instruction
+	/* VADD/VSUB/VMUL/VAND: a physical register per lane of the sources and destination */
+	int lanes;
+	int8_t lane_src1_tags[VLEN];
+	int8_t lane_src2_tags[VLEN];
+	int8_t lane_dest_regs[VLEN];
 } IQ_ENTRY;
 
+/* Per static instruction counters, indexed by get_code_index(pc) */
+typedef struct PC_PROFILE
+{
+	int executions;		// Times issued out of the IQ
+	int commits;
+	int rob_head_cycles;	// Cycles spent blocking the ROB head
+	int iq_wait_cycles;
+	int mispredicts;
+	int lsq_cycles;		// Dispatch to memory completion, summed
+} PC_PROFILE;
+
+/* Counters at the start of the current statistics interval */
+typedef struct INTERVAL_STATS
+{
+	int clock;
+	int ins_completed;
+	int branch_mispredicts;
+	int cycle_stack[NUM_CYCLE_CAUSES];
+	// Per cycle occupancy, summed over the interval
+	int rob_occupancy;
+	int iq_occupancy;
+	int lsq_occupancy;
+} INTERVAL_STATS;
+
 /* Model of CPU stage latch */
 typedef struct CPU_Stage
 {
 	int pc;		    // Program Counter
-	char opcode[128];	// Operation Code
+	uint8_t op;		// Operation Code, enum OPCODE
 	int rs1;		    // Source-1 Register Address
 	int rs2;		// Source-2 Register Address
 	int rs3;		//Source-3 Register Address
@@ -119,104 +304,369 @@ typedef struct CPU_Stage
 	int rs2_value;	// Source-2 Register Value
 	int rs3_value; //Source-3 Register Value
 	int buffer;		// Latch to hold some value
+	int lane_buffer[VLEN];	// Lane results of a vector instruction
 	int mem_address;	// Computed Memory Address
 	int busy;		    // Flag to indicate, stage is performing some action
 	int stalled;		// Flag to indicate, stage is stalled
 	int is_empty;
+	int seq;		// Dynamic instruction number, for the pipeline trace
 	IQ_ENTRY iq_entry;
 	
 } CPU_Stage;
 
-/* Model of APEX CPU */
-typedef struct APEX_CPU
+/*
+ * Double buffered latch in front of a stage. The stage works on cur,
+ * what was latched at the last clock edge, while the stage before it
+ * fills next. latch_clock() swaps the two for latches written in the
+ * cycle and leaves the others holding their contents, so stages can be
+ * evaluated in any order without copying latch contents between them.
+ * A stage that stalls on cur keeps it over the edge, with what was
+ * filled into next waiting behind it, and the stage before reads that
+ * as held from the next cycle on rather than the stall itself.
+ */
+typedef struct CPU_LATCH
 {
-	/* Clock cycles elasped */
-	int clock;
+	CPU_Stage* cur;
+	CPU_Stage* next;
+	int written;		// next was filled and waits to become cur
+	int held;		// cur stalled at the last clock edge, nothing may be filled into next
+} CPU_LATCH;
+
+/* Hardware thread contexts a core can hold, see APEX_cpu_add_thread */
+#define APEX_MAX_THREADS 4
+/* Every context beyond the first brings 16 more physical registers, to back its rename table */
+#define APEX_MAX_PRF (24 + 16 * (APEX_MAX_THREADS - 1))
+/* Register past the PRF that always holds 0 and is never allocated, zero idioms are renamed to it */
+#define APEX_ZERO_REG APEX_MAX_PRF
+
+/* Which thread gets the front end each cycle in SMT mode */
+enum FETCH_POLICY
+{
+	FETCH_ROUND_ROBIN,	// Next live thread in turn
+	FETCH_ICOUNT		// Live thread with the fewest instructions in decode and the IQ
+};
 
-	/* Current program counter */
+/*
+ * Per thread state of an SMT core: everything a program sees as its own,
+ * i.e. PC, ARF, rename table, branch checkpoints, BTB, ROB partition and
+ * the fetch/decode latches. The IQ, FUs, PRF and LSQ stay in APEX_CPU
+ * and are shared. A single threaded core only uses threads[0].
+ */
+typedef struct APEX_THREAD
+{
+	/* Current program counter, the next one to predict with the decoupled front end */
 	int pc;
 
 	/* Integer register file */
 	int regs[16];
 	int regs_valid[16];
 
-	/*Physical Register file with its AR values and list to indicate if PR is free or not*/
-	int phys_regs[24];
-	int phys_regs_valid[24];
-	// Index represents the PR and values 1- represents free,0 - represents occupied.
-	int free_PR_list[24];
-	int free_PR_list_checkpoint_1[24];
-	int free_PR_list_checkpoint_2[24];
-	//This is to hold flag condition flag for PR if any. 
-
-	int flag_condition[24];
-	//Number of consumers for every physical register.
-	int consumers[24];
-
 	//Rename table to contain info with Index represents the AR and values represents the Physical Register.
 	int rename_table[16];
+	// Mapping as of the last retired instruction, to restart from after a load value misprediction
+	int retired_rename_table[16];
+	int retired_arithmetic_phys_reg;
 
 	//NOTE: check if this is correct??
 	//Two extra array for branching purposes(checkpoint predict) still not clear why , need to check!
 	int checkpoint_rename_table_1[16];
 	int checkpoint_rename_table_2[16];
-
-	//NOTE: Check if this is correct??
-	/* Array of 9 CPU_stage */
-	CPU_Stage stage[9];
+	int free_PR_list_checkpoint_1[APEX_MAX_PRF];
+	int free_PR_list_checkpoint_2[APEX_MAX_PRF];
+
+	/*
+	 * Fetch and decode latches, indexed by F and DRF. Nothing feeds fetch,
+	 * so latch[F].cur is just the instruction it fetched last and
+	 * latch[F].next the buffer it fetches into while decode is stalled.
+	 */
+	CPU_LATCH latch[DRF + 1];
+	CPU_Stage latch_buffers[3];
+
+	/*
+	 * Decoupled front end, only used with an I-cache. Branch prediction
+	 * queues fetch blocks from pc in the FTQ, the I-cache stage fetches
+	 * them into the fetch buffer and fetch hands those to decode.
+	 */
+	FETCH_BLOCK FTQ[FTQ_SIZE];
+	int ftq_head;
+	int ftq_count;
+	int fetch_buffer[FETCH_BUFFER_SIZE];	// PCs of fetched instructions
+	int fetch_buffer_head;
+	int fetch_buffer_count;
+
+	LOOP_BUFFER loop_buffer;
+
+	LVP_ENTRY LVP[LVP_SIZE];
 
 	/* Code Memory where instructions are stored */
 	APEX_Instruction* code_memory;
 	int code_memory_size;
+	PC_PROFILE* pc_profile;
 
-	/* Data Memory */
-	int data_memory[4000];
-
-	/* Some stats */
-	int ins_completed;
-	IQ_ENTRY IQ[8];
 	ROB_ENTRY ROB[12];
-	LSQ_ENTRY LSQ[6];
+	/*
+	 * Commit and flush state of the ROB as a struct of arrays beside the
+	 * ROB_ENTRY payloads, so retiring and squashing read a few bytes per
+	 * entry. Bit i of rob_done stands for ROB[i].
+	 */
+	uint32_t rob_done;	// Result written, the entry can commit
+	int rob_seq[12];	// Dynamic instruction number, for the pipeline trace
+	int8_t rob_tags[12][2 + VLEN];	// Registers the entry writes, its fused MOVC's and lanes' included
+	uint8_t rob_tag_count[12];
 	BTB_ENTRY BTB[8];
 	BIS_ENTRY BIS[2];
 
 	int rob_head;
 	int rob_tail;
 
-	int lsq_head;
-	int lsq_tail;
-
 	int bis_head;
 	int bis_tail;
 
 	int btb_tail;
-	int checkpoint1_free;
-	int checkpoint2_free;
-	
-	int iq_free[8];
+
 	int latest_arithmetic_inst_phys_reg;
-	int execution_started;
-	int lsq_current_size;
 	int rob_current_size;
 	int bis_current_size;
+
+	// Set by flush, cleared once decode dispatches from the new path
+	int recovery_pending;
+	int last_dispatched_seq;
+	// Set once HALT is dispatched, cleared by a redirect
+	int stop_fetch_decode;
+	// Set once JUMP is dispatched, decode holds until it resolves or is squashed
+	int jump_pending;
+	int halted;		// This thread's HALT has committed
+	int halt_clock;
+	int ins_completed;
+
+	/* Set by branch_fu or a fused branch in INT2, acted on by flush at the end of the cycle */
+	int flush_and_reload;
+	BTB_ENTRY* mispredicted_branch_btb_entry;
+	IQ_ENTRY* mispredicted_branch_iq_entry;
+	int mispredicted_branch_target_address_new;
+} APEX_THREAD;
+
+/* Model of APEX CPU */
+typedef struct APEX_CPU
+{
+	/* Clock cycles elasped */
+	int clock;
+
+	/* Hardware thread contexts, threads[0] is the only one unless SMT is on */
+	APEX_THREAD threads[APEX_MAX_THREADS];
+	int num_threads;
+	int fetch_policy;	// enum FETCH_POLICY
+	int front_end_thread;	// Thread fetch and decode work on this cycle
+	int next_fetch_thread;	// Round robin position
+	int rob_partition;	// ROB entries each thread may hold, ROB_SIZE / num_threads
+	int prf_size;		// Physical registers in use, grows by 16 per extra thread
+
+	/*Physical Register file with its AR values and list to indicate if PR is free or not*/
+	int phys_regs[APEX_MAX_PRF + 1];
+	int phys_regs_valid[APEX_MAX_PRF + 1];
+	// Index represents the PR and values 1- represents free,0 - represents occupied.
+	int free_PR_list[APEX_MAX_PRF + 1];
+	// Thread that last allocated the PR, so a flush only restores its own entries of the free list
+	int phys_reg_owner[APEX_MAX_PRF + 1];
+	//This is to hold flag condition flag for PR if any. 
+
+	int flag_condition[APEX_MAX_PRF + 1];
+	//Number of consumers for every physical register.
+	int consumers[APEX_MAX_PRF + 1];
+	//Rename table entries of all threads mapping the PR, more than one once moves are eliminated.
+	int rename_refs[APEX_MAX_PRF + 1];
+	//Dispatched, uncommitted ROB entries writing the PR.
+	int writers[APEX_MAX_PRF + 1];
+	//Latest arithmetic results and live BIS checkpoints a recovery may map the PR again from.
+	int checkpoint_refs[APEX_MAX_PRF + 1];
+	//Retired rename table entries and retired arithmetic results, which hold the PR under value prediction.
+	int retired_refs[APEX_MAX_PRF + 1];
+
+	//NOTE: Check if this is correct??
+	/* Latches of NUM_STAGES stages, fetch and decode live in the thread */
+	CPU_LATCH latch[NUM_STAGES];
+	CPU_Stage latch_buffers[2][NUM_STAGES];
+
+	/* Opcode timing, the built in one unless replaced before the first cycle */
+	APEX_MACHINE machine;
+	int unit_next_issue[NUM_UNITS];	// Clock each unit takes an instruction again
+	/* Instructions past the last stage of their unit waiting out the rest of their latency */
+	CPU_Stage parked[NUM_UNITS * MACHINE_MAX_LATENCY];
+	int parked_ready[NUM_UNITS * MACHINE_MAX_LATENCY];	// Clock the result is due
+	int parked_stage[NUM_UNITS * MACHINE_MAX_LATENCY];	// INT2, MUL3 or BRANCH
+	uint64_t parked_valid;
+
+	/* Data Memory, sparse and paged, see memory.h */
+	APEX_MEMORY data_memory;
+	/* Private L1 in a multi-core system, NULL for a single core using data_memory */
+	L1_CACHE* l1;
+	/* Data prefetcher filling l1, see APEX_cpu_enable_prefetcher */
+	PREFETCHER* prefetcher;
+	/* Turns on the decoupled front end, see APEX_cpu_enable_icache */
+	ICACHE* icache;
+	int ftq_blocks;			// Blocks branch prediction queued
+	int fetch_buffer_empty_cycles;	// Decode starved by the front end
+	/* Loop stream buffer, off unless turned on before the first cycle */
+	int loop_buffer_enabled;
+	int loops_streamed;		// Loop bodies locked on to
+	int streamed_instructions;	// Handed to decode from the loop buffer
+	/* Macro-op fusion in decode, off unless turned on before the first cycle */
+	int fusion_enabled;
+	int fused_branches;		// Arithmetic + BZ/BNZ pairs
+	int fused_movcs;		// MOVC + ALU pairs
+	/* Move elimination at rename, off unless turned on before the first cycle */
+	int move_elimination_enabled;
+	int eliminated_moves;		// Copies and MOVCs of a literal a register already holds
+	int eliminated_zeros;		// Zero idioms renamed to APEX_ZERO_REG
+	/* Load value prediction, off unless turned on before the first cycle */
+	int value_prediction_enabled;
+	int lvp_loads;			// Loads executed
+	int lvp_predicted;		// of which dependents got a predicted value
+	int lvp_correct;
+	/* Load hit speculation, off unless turned on before the first cycle */
+	int load_speculation_enabled;
+	int spec_load_reg;		// Destination of the load whose dependents were woken early, -1 for none
+	int spec_load_value;		// Value they were woken with, read from memory at the wakeup
+	int spec_epoch;			// Counts speculative wakeups, IQ_ENTRY.spec_load names one
+	int spec_cancelled;		// Last wakeup cancelled, its dependents in INT1/MUL1 are dropped
+	int spec_loads;			// Loads that woke dependents a cycle before their value
+	int spec_replays;		// of which missed in the L1 or read another value, cancelling the wakeup
+	int spec_early_issues;		// Dependents issued back to back with a load that hit
+	int spec_wasted_issues;		// Dependents issued for a load that missed, then replayed
+
+	/* Some stats */
+	int ins_completed;	// All threads
+	IQ_ENTRY IQ[8];
+	LSQ_ENTRY LSQ[6];
+
+	int lsq_head;
+	int lsq_tail;
+	/* Owner of each LSQ entry beside the payloads, all a flush looks at */
+	uint8_t lsq_thread[6];
+	int8_t lsq_rob_index[6];
+	int8_t lsq_bis_index[6];	// Branch tag, see IQ_ENTRY bis_index
+
+	/*
+	 * Wakeup and select state of the IQ as a struct of arrays beside the
+	 * IQ_ENTRY payloads, so the per cycle scans read a few bytes per entry.
+	 * Bit i of each mask stands for IQ[i].
+	 */
+	uint32_t iq_valid;	// Occupied entries
+	uint32_t iq_src1_needed;	// Entry cannot issue before src1 is ready
+	uint32_t iq_src2_needed;
+	uint32_t iq_src1_ready;
+	uint32_t iq_src2_ready;
+	int8_t iq_src1_tag[8];
+	int8_t iq_src2_tag[8];
+	uint8_t iq_fu_type[8];
+	uint8_t iq_thread[8];
+	int8_t iq_bis_index[8];	// Kept equal to IQ[i].bis_index, which the FU latches take a copy of
+	int iq_pc[8];		// Select takes the lowest PC per FU type
+	uint32_t iq_spec_src1;	// Source marked ready by a speculative load wakeup
+	uint32_t iq_spec_src2;
+	uint32_t iq_held;	// Issued on a speculative wakeup, kept for a replay until the load hits
+	uint32_t iq_lanes;	// Vector entries, ready once every lane source register is valid
+	int execution_started;
+	int lsq_current_size;
+
+	/* CPI stack, indexed by enum CYCLE_CAUSE */
+	int cycle_stack[NUM_CYCLE_CAUSES];
+	int branch_mispredicts;
+	/* Host time per stage function, counted only in STAGE_PROFILE builds */
+	STAGE_PROFILE stage_profile;
+
+	/* Interval time series, written every interval_length cycles when interval_fp is set */
+	FILE* interval_fp;
+	char* interval_buffer;
+	int interval_length;
+	INTERVAL_STATS interval;
+
+	/* Pipeline trace, NULL when tracing is off */
+	APEX_TRACE* trace;
+	int next_seq;
+
+	int halted;		// HALT has committed on every thread
+	int last_commit_pc;
+	int last_commit_clock;
+	// APEX_cpu_run gives up after this many cycles without a commit, 0 is off
+	int watchdog_cycles;
+
+	/* Library hooks, see apex.h */
+	APEX_COMMIT_HOOK commit_hook;
+	void* commit_hook_data;
+	APEX_FLUSH_HOOK flush_hook;
+	void* flush_hook_data;
 } APEX_CPU;
 
 //physical registers, free list of physical registers, architectural registers, rename table, 2 checkpoint rename table.
 //head, tail for LSQ to implment a queue in an array.
 //Array for IQ free or implement a 
 
+/* Name programs spell each enum OPCODE with */
+extern const char* const opcode_names[NUM_OPCODES];
+
 APEX_Instruction*
 create_code_memory(const char* filename, int* size);
 
+APEX_Instruction*
+create_code_memory_from_stream(FILE* fp, int* size);
+
+int
+get_code_index(int pc);
+
 APEX_CPU*
 APEX_cpu_init(const char* filename);
 
+APEX_CPU*
+APEX_cpu_init_buffer(const char* buffer, size_t length);
+
+int
+APEX_cpu_add_thread(APEX_CPU* cpu, const char* filename);
+
+int
+APEX_cpu_enable_icache(APEX_CPU* cpu, const ICACHE_CONFIG* config);
+
+int
+APEX_cpu_enable_prefetcher(APEX_CPU* cpu, const PREFETCH_CONFIG* config);
+
+struct APEX_CHECKPOINT;
+
+int
+APEX_cpu_restore(APEX_CPU* cpu, struct APEX_CHECKPOINT* checkpoint);
+
+int
+APEX_cpu_cycle(APEX_CPU* cpu);
+
 int
 APEX_cpu_run(APEX_CPU *cpu, int no_of_cycles, int flag);
 
 void
 APEX_cpu_stop(APEX_CPU* cpu);
 
+int
+write_pc_profile(APEX_CPU* cpu, const char* filename);
+
+int
+print_watchdog_snapshot(APEX_CPU* cpu, FILE* fp);
+
+int
+print_register_state(APEX_CPU* cpu);
+
+int
+print_memory(APEX_MEMORY* memory);
+
+const char*
+cycle_cause_name(int cause);
+
+int
+print_thread_stats(APEX_CPU* cpu, const double* alone_ipc);
+
+int
+format_instruction(char* buffer, size_t size, APEX_Instruction* current_ins);
+
+int
+open_interval_stats(APEX_CPU* cpu, const char* filename, int interval_length);
+
 int
 fetch(APEX_CPU* cpu);
 
@@ -31,12 +31,42 @@ get_num_from_string(char* buffer)
   return atoi(str);
 }
 
+const char* const opcode_names[NUM_OPCODES] = {
+  [OP_EMPTY] = "", [OP_NOP] = "NOP", [OP_MOVC] = "MOVC", [OP_ADD] = "ADD", [OP_ADDL] = "ADDL",
+  [OP_SUB] = "SUB", [OP_SUBL] = "SUBL", [OP_MUL] = "MUL", [OP_AND] = "AND", [OP_OR] = "OR",
+  [OP_EXOR] = "EX-OR", [OP_LOAD] = "LOAD", [OP_LDR] = "LDR", [OP_STORE] = "STORE", [OP_STR] = "STR",
+  [OP_BZ] = "BZ", [OP_BNZ] = "BNZ", [OP_JUMP] = "JUMP", [OP_HALT] = "HALT", [OP_VADD] = "VADD",
+  [OP_VSUB] = "VSUB", [OP_VMUL] = "VMUL", [OP_VAND] = "VAND", [OP_VLOAD] = "VLOAD", [OP_VSTORE] = "VSTORE",
+};
+
+/* enum OPCODE of the instruction name opcode, OP_EMPTY for none */
+static int
+decode_opcode(const char* opcode)
+{
+  for (int op = OP_MOVC; op < NUM_OPCODES; op++) {
+    if (strcmp(opcode, opcode_names[op]) == 0) {
+      return op;
+    }
+  }
+  return OP_EMPTY;
+}
+
+/* A vector register operand names the first register of its group, R0, R4, R8 or R12 */
+static int
+is_vector_register(int reg)
+{
+  return reg >= 0 && reg % VLEN == 0 && reg + VLEN <= 16;
+}
+
 /*
  * This function is related to parsing input file
  *
  * Note : you can edit this function to add new instructions
+ *
+ * Returns 1 for a vector instruction naming a register that does not
+ * start a vector register group.
  */
-static void
+static int
 create_APEX_instruction(APEX_Instruction* ins, char* buffer)
 {
   char* token = strtok(buffer, ",");
@@ -49,6 +79,7 @@ create_APEX_instruction(APEX_Instruction* ins, char* buffer)
   }
 
   strcpy(ins->opcode, tokens[0]);
+  ins->op = decode_opcode(ins->opcode);
   ins->rs1 = ins->rs2 = ins->rs3 = -1;
   if (strcmp(ins->opcode, "MOVC") == 0) {
     ins->rd = get_num_from_string(tokens[1]);
@@ -77,8 +108,24 @@ create_APEX_instruction(APEX_Instruction* ins, char* buffer)
     ins->imm = get_num_from_string(tokens[2]);
   } else if(strcmp(ins->opcode, "HALT") == 0 || strcmp(ins->opcode, "HALT\n") == 0) {
     strcpy(ins->opcode, "HALT");
+    ins->op = OP_HALT;
+  } else if (simd_op(ins->opcode) >= 0) {
+    ins->rd = get_num_from_string(tokens[1]);
+    ins->rs1 = get_num_from_string(tokens[2]);
+    ins->rs2 = get_num_from_string(tokens[3]);
+    return !is_vector_register(ins->rd) || !is_vector_register(ins->rs1) || !is_vector_register(ins->rs2);
+  } else if (strcmp(ins->opcode, "VLOAD") == 0) {
+    ins->rd = get_num_from_string(tokens[1]);
+    ins->rs1 = get_num_from_string(tokens[2]);
+    ins->imm = get_num_from_string(tokens[3]);
+    return !is_vector_register(ins->rd);
+  } else if (strcmp(ins->opcode, "VSTORE") == 0) {
+    ins->rs1 = get_num_from_string(tokens[1]);
+    ins->rs2 = get_num_from_string(tokens[2]);
+    ins->imm = get_num_from_string(tokens[3]);
+    return !is_vector_register(ins->rs1);
   }
-
+  return 0;
 }
 
 /*
@@ -98,6 +145,19 @@ create_code_memory(const char* filename, int* size)
     return NULL;
   }
 
+  APEX_Instruction* code_memory = create_code_memory_from_stream(fp, size);
+  fclose(fp);
+  return code_memory;
+}
+
+/*
+ * Parses one instruction per line from fp, which must be seekable since
+ * it is read twice. The caller keeps ownership of fp. Returns NULL if a
+ * vector instruction names a register outside R0, R4, R8 and R12.
+ */
+APEX_Instruction*
+create_code_memory_from_stream(FILE* fp, int* size)
+{
   char* line = NULL;
   size_t len = 0;
   ssize_t nread;
@@ -108,25 +168,28 @@ create_code_memory(const char* filename, int* size)
   }
   *size = code_memory_size;
   if (!code_memory_size) {
-    fclose(fp);
+    free(line);
     return NULL;
   }
 
   APEX_Instruction* code_memory =
     malloc(sizeof(*code_memory) * code_memory_size);
   if (!code_memory) {
-    fclose(fp);
+    free(line);
     return NULL;
   }
 
   rewind(fp);
   int current_instruction = 0;
   while ((nread = getline(&line, &len, fp)) != -1) {
-    create_APEX_instruction(&code_memory[current_instruction], line);
+    if (create_APEX_instruction(&code_memory[current_instruction], line)) {
+      free(code_memory);
+      free(line);
+      return NULL;
+    }
     current_instruction++;
   }
 
   free(line);
-  fclose(fp);
   return code_memory;
 }
@@ -0,0 +1,377 @@
+/*
+ *  functional.c
+ *  Functional APEX interpreter used to fast forward and checkpoint
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "functional.h"
+
+/* Handlers past the enum OPCODE ones */
+enum FUNCTIONAL_OP
+{
+	OP_END = NUM_OPCODES,	// Falls through out of a block that does not end in a branch
+	NUM_FUNCTIONAL_OPS
+};
+
+int
+functional_init(APEX_FUNCTIONAL* func, const char* filename)
+{
+	memset(func, 0, sizeof(*func));
+	func->code_memory = create_code_memory(filename, &func->code_memory_size);
+	if (!func->code_memory) {
+		return 1;
+	}
+	func->ops = malloc(func->code_memory_size * sizeof(int));
+	func->blocks = calloc(func->code_memory_size, sizeof(FUNC_BLOCK*));
+	if (!func->ops || !func->blocks) {
+		free(func->code_memory);
+		free(func->ops);
+		free(func->blocks);
+		return 1;
+	}
+	for (int i = 0; i < func->code_memory_size; i++) {
+		func->ops[i] = func->code_memory[i].op;
+	}
+	/* Same reset state as the pipeline's ARF */
+	func->pc = 4000;
+	memset(func->regs, -1, sizeof(func->regs));
+	func->last_result_reg = -1;
+	return 0;
+}
+
+/* Whether op ends a basic block, leaving it for a target the block cannot know */
+static int
+ends_block(int op)
+{
+	return op == OP_BZ || op == OP_BNZ || op == OP_JUMP || op == OP_HALT;
+}
+
+/*
+ * Translates the basic block starting at code index start, through its
+ * first BZ/BNZ/JUMP/HALT or the end of code memory, binding each
+ * instruction's operands to the handler of its opcode. A block without
+ * a branch at its end gets an OP_END handler that falls through.
+ */
+static FUNC_BLOCK*
+translate_block(APEX_FUNCTIONAL* func, int start, const void* const* handlers)
+{
+	int count = 0;
+	while (start + count < func->code_memory_size && !ends_block(func->ops[start + count])) {
+		count++;
+	}
+	int ends_in_branch = start + count < func->code_memory_size;
+	count += ends_in_branch;
+	FUNC_BLOCK* block = calloc(1, sizeof(FUNC_BLOCK) + (count + !ends_in_branch) * sizeof(FUNC_OP));
+	if (!block) {
+		return NULL;
+	}
+	block->count = count;
+	block->end_pc = 4000 + 4 * (start + count - 1);
+	for (int i = 0; i < count; i++) {
+		APEX_Instruction* ins = &func->code_memory[start + i];
+		FUNC_OP* op = &block->ops[i];
+		op->handler = handlers[func->ops[start + i]];
+		op->rd = ins->rd;
+		op->rs1 = ins->rs1;
+		op->rs2 = ins->rs2;
+		op->rs3 = ins->rs3;
+		op->imm = ins->imm;
+	}
+	if (!ends_in_branch) {
+		block->ops[count].handler = handlers[OP_END];
+	}
+	return block;
+}
+
+/* Cached block starting at pc, translating it on first use; NULL off code memory or a word boundary */
+static FUNC_BLOCK*
+block_at(APEX_FUNCTIONAL* func, int pc, const void* const* handlers)
+{
+	unsigned int index = get_code_index(pc);
+	if (pc < 4000 || (pc - 4000) % 4 != 0 || index >= (unsigned int) func->code_memory_size) {
+		return NULL;
+	}
+	if (!func->blocks[index]) {
+		func->blocks[index] = translate_block(func, index, handlers);
+	}
+	return func->blocks[index];
+}
+
+/*
+ * Executes the instruction at the PC on its own. Returns 0, setting
+ * halted, when the PC has left code memory.
+ */
+static int
+functional_step(APEX_FUNCTIONAL* func)
+{
+	int* regs = func->regs;
+	unsigned int index = get_code_index(func->pc);
+	if (func->pc < 4000 || index >= (unsigned int) func->code_memory_size) {
+		func->halted = 1;
+		return 0;
+	}
+	APEX_Instruction* ins = &func->code_memory[index];
+	int next_pc = func->pc + 4;
+	switch (func->ops[index]) {
+	case OP_MOVC:
+		regs[ins->rd] = ins->imm;
+		break;
+	case OP_ADD:
+		regs[ins->rd] = func->last_result = regs[ins->rs1] + regs[ins->rs2];
+		func->last_result_reg = ins->rd;
+		break;
+	case OP_ADDL:
+		regs[ins->rd] = func->last_result = regs[ins->rs1] + ins->imm;
+		func->last_result_reg = ins->rd;
+		break;
+	case OP_SUB:
+		regs[ins->rd] = func->last_result = regs[ins->rs1] - regs[ins->rs2];
+		func->last_result_reg = ins->rd;
+		break;
+	case OP_SUBL:
+		regs[ins->rd] = func->last_result = regs[ins->rs1] - ins->imm;
+		func->last_result_reg = ins->rd;
+		break;
+	case OP_MUL:
+		regs[ins->rd] = func->last_result = regs[ins->rs1] * regs[ins->rs2];
+		func->last_result_reg = ins->rd;
+		break;
+	case OP_AND:
+		regs[ins->rd] = regs[ins->rs1] & regs[ins->rs2];
+		break;
+	case OP_OR:
+		regs[ins->rd] = regs[ins->rs1] | regs[ins->rs2];
+		break;
+	case OP_EXOR:
+		regs[ins->rd] = regs[ins->rs1] ^ regs[ins->rs2];
+		break;
+	case OP_LOAD:
+		regs[ins->rd] = mem_read(&func->memory, (uint32_t) (regs[ins->rs1] + ins->imm));
+		break;
+	case OP_LDR:
+		regs[ins->rd] = mem_read(&func->memory, (uint32_t) (regs[ins->rs1] + regs[ins->rs2]));
+		break;
+	case OP_STORE:
+		mem_write(&func->memory, (uint32_t) (regs[ins->rs2] + ins->imm), regs[ins->rs1]);
+		break;
+	case OP_STR:
+		mem_write(&func->memory, (uint32_t) (regs[ins->rs2] + regs[ins->rs3]), regs[ins->rs1]);
+		break;
+	case OP_BZ:
+		if (func->last_result == 0) {
+			next_pc = func->pc + ins->imm;
+		}
+		break;
+	case OP_BNZ:
+		if (func->last_result != 0) {
+			next_pc = func->pc + ins->imm;
+		}
+		break;
+	case OP_JUMP:
+		next_pc = regs[ins->rs1] + ins->imm;
+		break;
+	case OP_HALT:
+		func->halted = 1;
+		break;
+	case OP_VADD:
+	case OP_VSUB:
+	case OP_VMUL:
+	case OP_VAND:
+		/* The four opcodes are in SIMD_OP order, lanes are registers rd..rd+VLEN-1 */
+		simd_execute(func->ops[index] - OP_VADD + SIMD_ADD, &regs[ins->rs1], &regs[ins->rs2], &regs[ins->rd]);
+		break;
+	case OP_VLOAD:
+		mem_read_words(&func->memory, (uint32_t) (regs[ins->rs1] + ins->imm), &regs[ins->rd], VLEN);
+		break;
+	case OP_VSTORE:
+		mem_write_words(&func->memory, (uint32_t) (regs[ins->rs2] + ins->imm), &regs[ins->rs1], VLEN);
+		break;
+	default:
+		break;
+	}
+	func->pc = next_pc;
+	return 1;
+}
+
+/*
+ * Executes up to max_instructions, stopping early at HALT or when the PC
+ * leaves code memory. Returns how many instructions ran.
+ *
+ * Whole basic blocks run as direct threaded code: each handler does its
+ * instruction and jumps straight to the handler of the next, and the
+ * branch ending a block follows the successor it chained on that edge
+ * the first time it was taken, without looking the PC up again. A block
+ * longer than the instructions left, or a PC off a word boundary, goes
+ * one instruction at a time through functional_step.
+ */
+long long
+functional_run(APEX_FUNCTIONAL* func, long long max_instructions)
+{
+	static const void* const handlers[NUM_FUNCTIONAL_OPS] = {
+		[OP_MOVC] = &&op_movc, [OP_ADD] = &&op_add, [OP_ADDL] = &&op_addl, [OP_SUB] = &&op_sub,
+		[OP_SUBL] = &&op_subl, [OP_MUL] = &&op_mul, [OP_AND] = &&op_and, [OP_OR] = &&op_or,
+		[OP_EXOR] = &&op_exor, [OP_LOAD] = &&op_load, [OP_LDR] = &&op_ldr, [OP_STORE] = &&op_store,
+		[OP_STR] = &&op_str, [OP_BZ] = &&op_bz, [OP_BNZ] = &&op_bnz, [OP_JUMP] = &&op_jump,
+		[OP_HALT] = &&op_halt, [OP_VADD] = &&op_vadd, [OP_VSUB] = &&op_vsub, [OP_VMUL] = &&op_vmul,
+		[OP_VAND] = &&op_vand, [OP_VLOAD] = &&op_vload, [OP_VSTORE] = &&op_vstore, [OP_NOP] = &&op_nop,
+		[OP_EMPTY] = &&op_nop, [OP_END] = &&op_end,
+	};
+	int* regs = func->regs;
+	APEX_MEMORY* memory = &func->memory;
+	long long executed = 0;
+	FUNC_BLOCK* block = NULL;
+	FUNC_BLOCK** successor;
+	const FUNC_OP* op;
+	int next_pc;
+#define NEXT() goto *(++op)->handler
+	while (executed < max_instructions && !func->halted) {
+		if (!block) {
+			block = block_at(func, func->pc, handlers);
+		}
+		if (!block || block->count > max_instructions - executed) {
+			block = NULL;
+			executed += functional_step(func);
+			continue;
+		}
+		op = block->ops;
+		goto *op->handler;
+	op_movc:
+		regs[op->rd] = op->imm;
+		NEXT();
+	op_add:
+		regs[op->rd] = func->last_result = regs[op->rs1] + regs[op->rs2];
+		func->last_result_reg = op->rd;
+		NEXT();
+	op_addl:
+		regs[op->rd] = func->last_result = regs[op->rs1] + op->imm;
+		func->last_result_reg = op->rd;
+		NEXT();
+	op_sub:
+		regs[op->rd] = func->last_result = regs[op->rs1] - regs[op->rs2];
+		func->last_result_reg = op->rd;
+		NEXT();
+	op_subl:
+		regs[op->rd] = func->last_result = regs[op->rs1] - op->imm;
+		func->last_result_reg = op->rd;
+		NEXT();
+	op_mul:
+		regs[op->rd] = func->last_result = regs[op->rs1] * regs[op->rs2];
+		func->last_result_reg = op->rd;
+		NEXT();
+	op_and:
+		regs[op->rd] = regs[op->rs1] & regs[op->rs2];
+		NEXT();
+	op_or:
+		regs[op->rd] = regs[op->rs1] | regs[op->rs2];
+		NEXT();
+	op_exor:
+		regs[op->rd] = regs[op->rs1] ^ regs[op->rs2];
+		NEXT();
+	op_load:
+		regs[op->rd] = mem_read(memory, (uint32_t) (regs[op->rs1] + op->imm));
+		NEXT();
+	op_ldr:
+		regs[op->rd] = mem_read(memory, (uint32_t) (regs[op->rs1] + regs[op->rs2]));
+		NEXT();
+	op_store:
+		mem_write(memory, (uint32_t) (regs[op->rs2] + op->imm), regs[op->rs1]);
+		NEXT();
+	op_str:
+		mem_write(memory, (uint32_t) (regs[op->rs2] + regs[op->rs3]), regs[op->rs1]);
+		NEXT();
+	op_vadd:
+		simd_execute(SIMD_ADD, &regs[op->rs1], &regs[op->rs2], &regs[op->rd]);
+		NEXT();
+	op_vsub:
+		simd_execute(SIMD_SUB, &regs[op->rs1], &regs[op->rs2], &regs[op->rd]);
+		NEXT();
+	op_vmul:
+		simd_execute(SIMD_MUL, &regs[op->rs1], &regs[op->rs2], &regs[op->rd]);
+		NEXT();
+	op_vand:
+		simd_execute(SIMD_AND, &regs[op->rs1], &regs[op->rs2], &regs[op->rd]);
+		NEXT();
+	op_vload:
+		mem_read_words(memory, (uint32_t) (regs[op->rs1] + op->imm), &regs[op->rd], VLEN);
+		NEXT();
+	op_vstore:
+		mem_write_words(memory, (uint32_t) (regs[op->rs2] + op->imm), &regs[op->rs1], VLEN);
+		NEXT();
+	op_nop:
+		NEXT();
+	op_bz:
+		if (func->last_result == 0) {
+			next_pc = block->end_pc + op->imm;
+			successor = &block->taken;
+		} else {
+			next_pc = block->end_pc + 4;
+			successor = &block->not_taken;
+		}
+		goto chain;
+	op_bnz:
+		if (func->last_result != 0) {
+			next_pc = block->end_pc + op->imm;
+			successor = &block->taken;
+		} else {
+			next_pc = block->end_pc + 4;
+			successor = &block->not_taken;
+		}
+		goto chain;
+	op_end:
+		next_pc = block->end_pc + 4;
+		successor = &block->not_taken;
+	chain:
+		executed += block->count;
+		func->pc = next_pc;
+		if (!*successor) {
+			*successor = block_at(func, next_pc, handlers);
+		}
+		block = *successor;
+		continue;
+	op_jump:
+		// The target is a register, so there is no single successor to chain
+		executed += block->count;
+		func->pc = regs[op->rs1] + op->imm;
+		block = NULL;
+		continue;
+	op_halt:
+		executed += block->count;
+		func->pc = block->end_pc + 4;
+		func->halted = 1;
+	}
+#undef NEXT
+	func->instructions += executed;
+	return executed;
+}
+
+/* Snapshots the current state into checkpoint, which gets its own copy of memory */
+void
+functional_checkpoint(APEX_FUNCTIONAL* func, APEX_CHECKPOINT* checkpoint)
+{
+	memset(checkpoint, 0, sizeof(*checkpoint));
+	checkpoint->instructions = func->instructions;
+	checkpoint->pc = func->pc;
+	memcpy(checkpoint->regs, func->regs, sizeof(checkpoint->regs));
+	checkpoint->last_result = func->last_result;
+	checkpoint->last_result_reg = func->last_result_reg;
+	mem_copy_dirty_pages(&checkpoint->memory, &func->memory);
+}
+
+void
+checkpoint_free(APEX_CHECKPOINT* checkpoint)
+{
+	mem_free(&checkpoint->memory);
+}
+
+void
+functional_free(APEX_FUNCTIONAL* func)
+{
+	mem_free(&func->memory);
+	free(func->code_memory);
+	free(func->ops);
+	for (int i = 0; i < func->code_memory_size; i++) {
+		free(func->blocks[i]);
+	}
+	free(func->blocks);
+}
@@ -0,0 +1,79 @@
+#ifndef _APEX_FUNCTIONAL_H_
+#define _APEX_FUNCTIONAL_H_
+/**
+ *  functional.h
+ *  Functional execution of APEX programs
+ *
+ *  Executes the ISA architecturally, without any timing: no pipeline,
+ *  renaming or prediction, just PC, ARF, the zero flag and data memory.
+ *  It is used to fast forward through a program and to take
+ *  architectural checkpoints the detailed model can start from. Each
+ *  basic block is translated the first time it runs into handlers with
+ *  their operands bound, then runs as direct threaded code chained to
+ *  the blocks on its taken and not taken edges.
+ */
+#include "cpu.h"
+#include "memory.h"
+
+/* Architectural state after a given number of executed instructions */
+typedef struct APEX_CHECKPOINT
+{
+	long long instructions;	// Executed before this point
+	int pc;
+	int regs[16];
+	int last_result;	// Of the last ADD/ADDL/SUB/SUBL/MUL, tested by BZ/BNZ
+	int last_result_reg;	// Its destination, -1 before the first one
+	APEX_MEMORY memory;	// Pages stored to so far, on top of the data image
+} APEX_CHECKPOINT;
+
+/* One instruction of a translated block: its handler and operands */
+typedef struct FUNC_OP
+{
+	const void* handler;	// Label of the opcode's handler in functional_run
+	int rd;
+	int rs1;
+	int rs2;
+	int rs3;
+	int imm;
+} FUNC_OP;
+
+typedef struct FUNC_BLOCK
+{
+	int count;		// Instructions, including the branch or HALT ending it
+	int end_pc;		// Of the last instruction
+	struct FUNC_BLOCK* taken;	// Successors, chained the first time each edge is followed
+	struct FUNC_BLOCK* not_taken;
+	FUNC_OP ops[];		// count of them, plus an OP_END when no branch ends the block
+} FUNC_BLOCK;
+
+typedef struct APEX_FUNCTIONAL
+{
+	APEX_Instruction* code_memory;	// Owned
+	int code_memory_size;
+	int* ops;		// Opcode of each instruction, decoded once
+	FUNC_BLOCK** blocks;	// Block starting at each instruction, NULL until it first runs
+	long long instructions;
+	int pc;
+	int regs[16];
+	int last_result;
+	int last_result_reg;
+	int halted;		// HALT executed or the PC left code memory
+	APEX_MEMORY memory;
+} APEX_FUNCTIONAL;
+
+int
+functional_init(APEX_FUNCTIONAL* func, const char* filename);
+
+long long
+functional_run(APEX_FUNCTIONAL* func, long long max_instructions);
+
+void
+functional_checkpoint(APEX_FUNCTIONAL* func, APEX_CHECKPOINT* checkpoint);
+
+void
+checkpoint_free(APEX_CHECKPOINT* checkpoint);
+
+void
+functional_free(APEX_FUNCTIONAL* func);
+
+#endif
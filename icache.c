@@ -0,0 +1,180 @@
+/*
+ *  icache.c
+ *  Instruction cache tags, fills and prefetches
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "icache.h"
+
+int
+icache_init(ICACHE* cache, const ICACHE_CONFIG* config)
+{
+	memset(cache, 0, sizeof(*cache));
+	if (config->sets < 1 || config->ways < 1 || config->line_words < 1 || config->miss_latency < 0) {
+		return 1;
+	}
+	cache->config = *config;
+	int slots = config->sets * config->ways;
+	cache->tags = calloc(slots, sizeof(uint64_t));
+	cache->valid = calloc(slots, sizeof(int));
+	cache->last_use = calloc(slots, sizeof(int));
+	cache->prefetched = calloc(slots, sizeof(int));
+	if (!cache->tags || !cache->valid || !cache->last_use || !cache->prefetched) {
+		icache_free(cache);
+		return 1;
+	}
+	return 0;
+}
+
+void
+icache_free(ICACHE* cache)
+{
+	free(cache->tags);
+	free(cache->valid);
+	free(cache->last_use);
+	free(cache->prefetched);
+	memset(cache, 0, sizeof(*cache));
+}
+
+/* Line number of the instruction at pc, code memory starting at 4000 */
+uint32_t
+icache_line(const ICACHE* cache, int pc)
+{
+	return (uint32_t) (pc / 4) / cache->config.line_words;
+}
+
+static uint64_t
+make_tag(const ICACHE* cache, int space, int pc)
+{
+	return (uint64_t) space << 32 | icache_line(cache, pc);
+}
+
+static int
+set_of(const ICACHE* cache, uint64_t tag)
+{
+	return (uint32_t) tag % cache->config.sets;
+}
+
+/* Slot holding the line tagged tag, or -1 */
+static int
+lookup(ICACHE* cache, uint64_t tag)
+{
+	int base = set_of(cache, tag) * cache->config.ways;
+	for (int way = 0; way < cache->config.ways; way++) {
+		if (cache->valid[base + way] && cache->tags[base + way] == tag) {
+			return base + way;
+		}
+	}
+	return -1;
+}
+
+/* Installs the fills that have arrived by clock, over the LRU way of their set */
+static void
+install_fills(ICACHE* cache, int clock)
+{
+	for (int i = 0; i < ICACHE_FILLS; i++) {
+		ICACHE_FILL* fill = &cache->fills[i];
+		if (!fill->valid || fill->ready_clock > clock) {
+			continue;
+		}
+		int base = set_of(cache, fill->tag) * cache->config.ways;
+		int victim = base;
+		for (int way = 0; way < cache->config.ways; way++) {
+			int slot = base + way;
+			if (!cache->valid[slot]) {
+				victim = slot;
+				break;
+			}
+			if (cache->last_use[slot] < cache->last_use[victim]) {
+				victim = slot;
+			}
+		}
+		cache->tags[victim] = fill->tag;
+		cache->valid[victim] = 1;
+		cache->last_use[victim] = clock;
+		cache->prefetched[victim] = fill->prefetch;
+		fill->valid = 0;
+	}
+}
+
+static ICACHE_FILL*
+pending_fill(ICACHE* cache, uint64_t tag)
+{
+	for (int i = 0; i < ICACHE_FILLS; i++) {
+		if (cache->fills[i].valid && cache->fills[i].tag == tag) {
+			return &cache->fills[i];
+		}
+	}
+	return NULL;
+}
+
+/* Starts filling the line tagged tag if a fill buffer is free, keeping reserve of them free */
+static int
+start_fill(ICACHE* cache, uint64_t tag, int clock, int prefetch, int reserve)
+{
+	ICACHE_FILL* free_fill = NULL;
+	int free_fills = 0;
+	for (int i = 0; i < ICACHE_FILLS; i++) {
+		if (!cache->fills[i].valid) {
+			free_fill = &cache->fills[i];
+			free_fills += 1;
+		}
+	}
+	if (free_fills <= reserve) {
+		return 0;
+	}
+	free_fill->tag = tag;
+	free_fill->ready_clock = clock + cache->config.miss_latency;
+	free_fill->prefetch = prefetch;
+	free_fill->valid = 1;
+	return 1;
+}
+
+/*
+ * Demand access of fetch to the line holding pc in address space space.
+ * Returns 1 on a hit; on a miss starts or joins the line's fill and
+ * fetch tries again next cycle.
+ */
+int
+icache_fetch(ICACHE* cache, int space, int pc, int clock)
+{
+	install_fills(cache, clock);
+	uint64_t tag = make_tag(cache, space, pc);
+	int slot = lookup(cache, tag);
+	if (slot >= 0) {
+		if (cache->prefetched[slot]) {
+			cache->prefetched[slot] = 0;
+			cache->stats.useful_prefetches += 1;
+		}
+		cache->last_use[slot] = clock;
+		cache->stats.hits += 1;
+		return 1;
+	}
+	cache->stats.stall_cycles += 1;
+	ICACHE_FILL* fill = pending_fill(cache, tag);
+	if (fill) {
+		if (fill->prefetch) {
+			fill->prefetch = 0;
+			cache->stats.useful_prefetches += 1;
+			cache->stats.late_prefetches += 1;
+		}
+	} else if (start_fill(cache, tag, clock, 0, 0)) {
+		cache->stats.misses += 1;
+	}
+	return 0;
+}
+
+/* Starts filling the line holding pc ahead of fetch, unless present or on its way */
+void
+icache_prefetch(ICACHE* cache, int space, int pc, int clock)
+{
+	install_fills(cache, clock);
+	uint64_t tag = make_tag(cache, space, pc);
+	if (lookup(cache, tag) >= 0 || pending_fill(cache, tag)) {
+		return;
+	}
+	if (start_fill(cache, tag, clock, 1, 1)) {
+		cache->stats.prefetches += 1;
+	}
+}
@@ -0,0 +1,76 @@
+#ifndef _APEX_ICACHE_H_
+#define _APEX_ICACHE_H_
+/**
+ *  icache.h
+ *  Set associative instruction cache of the decoupled front end
+ *
+ *  Like the L1 data caches it only tracks tags; instructions are always
+ *  read from code memory. Lines are tagged with an address space as well,
+ *  as SMT threads each run their own code memory from PC 4000. A miss starts a fill that lands miss_latency
+ *  cycles later in one of ICACHE_FILLS fill buffers, which demand misses
+ *  and prefetches along the fetch target queue share. Prefetches may
+ *  never take the last free fill buffer, so a demand miss can always
+ *  start.
+ */
+#include <stdint.h>
+
+#define ICACHE_SETS 16
+#define ICACHE_WAYS 2
+#define ICACHE_LINE_WORDS 4	// Instructions per line
+#define ICACHE_MISS_LATENCY 10	// Cycles to fill a line from memory
+#define ICACHE_FILLS 4		// Outstanding fills
+
+typedef struct ICACHE_CONFIG
+{
+	int sets;
+	int ways;
+	int line_words;
+	int miss_latency;
+} ICACHE_CONFIG;
+
+typedef struct ICACHE_STATS
+{
+	int hits;
+	int misses;		// Demand fills started
+	int stall_cycles;	// Fetch waited on a fill
+	int prefetches;		// Prefetch fills started
+	int useful_prefetches;	// Prefetched lines fetch used, in time or not
+	int late_prefetches;	// Fetch caught up with a prefetch still filling
+} ICACHE_STATS;
+
+typedef struct ICACHE_FILL
+{
+	uint64_t tag;
+	int ready_clock;
+	int prefetch;
+	int valid;
+} ICACHE_FILL;
+
+typedef struct ICACHE
+{
+	ICACHE_CONFIG config;
+	/* sets * ways of each, way w of set s at s * ways + w */
+	uint64_t* tags;		// Address space above the line number
+	int* valid;
+	int* last_use;		// Clock of the last access, for LRU
+	int* prefetched;	// Filled by a prefetch and not fetched from yet
+	ICACHE_FILL fills[ICACHE_FILLS];
+	ICACHE_STATS stats;
+} ICACHE;
+
+int
+icache_init(ICACHE* cache, const ICACHE_CONFIG* config);
+
+void
+icache_free(ICACHE* cache);
+
+uint32_t
+icache_line(const ICACHE* cache, int pc);
+
+int
+icache_fetch(ICACHE* cache, int space, int pc, int clock);
+
+void
+icache_prefetch(ICACHE* cache, int space, int pc, int clock);
+
+#endif
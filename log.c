@@ -0,0 +1,131 @@
+/*
+ *  log.c
+ *  Contains the runtime state of the logging subsystem
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "log.h"
+
+#define LOG_BUFFER_SIZE (1 << 16)
+
+int apex_log_levels[NUM_LOG_SUBSYSTEMS];
+FILE* apex_log_sink;
+
+static char sink_buffer[LOG_BUFFER_SIZE];
+static int sink_buffered;
+
+static const char* subsystem_names[NUM_LOG_SUBSYSTEMS] = {
+	"cpu", "fetch", "decode", "issue", "exec", "mem", "commit", "flush"
+};
+
+static const char* level_names[] = {
+	"none", "error", "info", "debug", "trace"
+};
+
+/*
+ * Switches the sink to full buffering the first time anything is
+ * enabled, so per cycle dumps are not written out line by line.
+ */
+static void
+log_buffer_sink(void)
+{
+	if (!apex_log_sink) {
+		apex_log_sink = stdout;
+	}
+	if (!sink_buffered) {
+		setvbuf(apex_log_sink, sink_buffer, _IOFBF, LOG_BUFFER_SIZE);
+		sink_buffered = 1;
+	}
+}
+
+/* Raises every subsystem to at least level */
+void
+log_set_all_levels(int level)
+{
+	for (int i = 0; i < NUM_LOG_SUBSYSTEMS; i++) {
+		if (apex_log_levels[i] < level) {
+			apex_log_levels[i] = level;
+		}
+	}
+	if (level > LOG_NONE) {
+		log_buffer_sink();
+	}
+}
+
+/*
+ * Parses "subsystem:level[,subsystem:level...]", where subsystem may
+ * also be "all". Returns non-zero on a malformed spec.
+ */
+int
+log_parse_levels(const char* spec)
+{
+	char copy[256];
+	strncpy(copy, spec, sizeof(copy) - 1);
+	copy[sizeof(copy) - 1] = '\0';
+
+	for (char* token = strtok(copy, ","); token != NULL; token = strtok(NULL, ",")) {
+		char* colon = strchr(token, ':');
+		if (!colon) {
+			return 1;
+		}
+		*colon = '\0';
+		int level = -1;
+		for (int i = 0; i < (int) (sizeof(level_names) / sizeof(level_names[0])); i++) {
+			if (strcmp(colon + 1, level_names[i]) == 0) {
+				level = i;
+			}
+		}
+		if (level < 0) {
+			return 1;
+		}
+		if (level > APEX_LOG_MAX_LEVEL) {
+			fprintf(stderr, "APEX_Warning : log level %s is compiled out, rebuild with LOG_MAX_LEVEL=LOG_TRACE\n", colon + 1);
+		}
+		if (strcmp(token, "all") == 0) {
+			for (int i = 0; i < NUM_LOG_SUBSYSTEMS; i++) {
+				apex_log_levels[i] = level;
+			}
+		} else {
+			int i;
+			for (i = 0; i < NUM_LOG_SUBSYSTEMS; i++) {
+				if (strcmp(token, subsystem_names[i]) == 0) {
+					apex_log_levels[i] = level;
+					break;
+				}
+			}
+			if (i == NUM_LOG_SUBSYSTEMS) {
+				return 1;
+			}
+		}
+	}
+	log_buffer_sink();
+	return 0;
+}
+
+/* Sends log output to filename instead of stdout; call before enabling anything */
+int
+log_open_sink(const char* filename)
+{
+	FILE* fp = fopen(filename, "w");
+	if (!fp) {
+		return 1;
+	}
+	apex_log_sink = fp;
+	return 0;
+}
+
+void
+log_close(void)
+{
+	if (!apex_log_sink) {
+		return;
+	}
+	fflush(apex_log_sink);
+	if (apex_log_sink != stdout) {
+		fclose(apex_log_sink);
+		apex_log_sink = NULL;
+		sink_buffered = 0;
+	}
+}
@@ -0,0 +1,67 @@
+#ifndef _APEX_LOG_H_
+#define _APEX_LOG_H_
+/**
+ *  log.h
+ *  Leveled, per-subsystem logging for the simulator
+ *
+ *  APEX_LOG_MAX_LEVEL caps what gets compiled in: a call above it is a
+ *  constant-false branch and compiles to nothing. Below the cap, a call
+ *  costs one array load and compare until its subsystem is turned up.
+ */
+#include <stdio.h>
+
+enum LOG_SUBSYSTEM
+{
+	LOG_CPU,
+	LOG_FETCH,
+	LOG_DECODE,
+	LOG_ISSUE,
+	LOG_EXEC,
+	LOG_MEM,
+	LOG_COMMIT,
+	LOG_FLUSH,
+	NUM_LOG_SUBSYSTEMS
+};
+
+enum LOG_LEVEL
+{
+	LOG_NONE,
+	LOG_ERROR,
+	LOG_INFO,
+	LOG_DEBUG,	// Per cycle pipeline dumps ("simulate" mode)
+	LOG_TRACE	// Per entry chatter from inside the stages
+};
+
+#ifndef APEX_LOG_MAX_LEVEL
+#define APEX_LOG_MAX_LEVEL LOG_DEBUG
+#endif
+
+extern int apex_log_levels[NUM_LOG_SUBSYSTEMS];
+extern FILE* apex_log_sink;
+
+#define LOG_ENABLED(subsystem, level) \
+	((level) <= APEX_LOG_MAX_LEVEL && (level) <= apex_log_levels[subsystem])
+
+/* Unconditional write to the sink, for use inside a LOG_ENABLED block */
+#define log_printf(...) fprintf(apex_log_sink, __VA_ARGS__)
+
+#define APEX_LOG(subsystem, level, ...) \
+	do { \
+		if (LOG_ENABLED(subsystem, level)) { \
+			log_printf(__VA_ARGS__); \
+		} \
+	} while (0)
+
+void
+log_set_all_levels(int level);
+
+int
+log_parse_levels(const char* spec);
+
+int
+log_open_sink(const char* filename);
+
+void
+log_close(void);
+
+#endif
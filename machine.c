@@ -0,0 +1,141 @@
+/*
+ *  machine.c
+ *  Machine description tables and their file format
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "machine.h"
+
+static const OPCODE_TIMING default_timing[MACHINE_MAX_OPCODES] = {
+	{"MOVC", UNIT_INT, 2, 1},
+	{"ADD", UNIT_INT, 2, 1},
+	{"ADDL", UNIT_INT, 2, 1},
+	{"SUB", UNIT_INT, 2, 1},
+	{"SUBL", UNIT_INT, 2, 1},
+	{"AND", UNIT_INT, 2, 1},
+	{"OR", UNIT_INT, 2, 1},
+	{"EX-OR", UNIT_INT, 2, 1},
+	{"MUL", UNIT_MUL, 3, 1},
+	{"VADD", UNIT_INT, 2, 1},
+	{"VSUB", UNIT_INT, 2, 1},
+	{"VAND", UNIT_INT, 2, 1},
+	{"VMUL", UNIT_MUL, 3, 1},
+	{"LOAD", UNIT_MEM, 3, 1},
+	{"LDR", UNIT_MEM, 3, 1},
+	{"STORE", UNIT_MEM, 3, 1},
+	{"STR", UNIT_MEM, 3, 1},
+	{"VLOAD", UNIT_MEM, 3, 1},
+	{"VSTORE", UNIT_MEM, 3, 1},
+	{"BZ", UNIT_BRANCH, 1, 1},
+	{"BNZ", UNIT_BRANCH, 1, 1},
+	{"JUMP", UNIT_BRANCH, 1, 1},
+};
+
+static const char* unit_names[NUM_UNITS] = {"INT", "MUL", "BRANCH", "MEM"};
+
+void
+machine_init(APEX_MACHINE* machine)
+{
+	memcpy(machine->ops, default_timing, sizeof(default_timing));
+	machine->num_ops = MACHINE_MAX_OPCODES;
+}
+
+/* Stages of unit an instruction passes through, the least latency it can have */
+int
+machine_unit_stages(int unit)
+{
+	switch (unit) {
+	case UNIT_INT:
+		return 2;
+	case UNIT_MUL:
+		return 3;
+	default:
+		return 1;
+	}
+}
+
+/* NULL for opcodes without a timing, like HALT, which go down INT at its depth */
+const OPCODE_TIMING*
+machine_timing(const APEX_MACHINE* machine, const char* opcode)
+{
+	for (int i = 0; i < machine->num_ops; i++) {
+		if (strcmp(machine->ops[i].opcode, opcode) == 0) {
+			return &machine->ops[i];
+		}
+	}
+	return NULL;
+}
+
+/* Whether opcode can execute on unit, whose stages only implement some operations */
+static int
+unit_allowed(const char* opcode, int unit)
+{
+	const OPCODE_TIMING* timing = NULL;
+	for (int i = 0; i < MACHINE_MAX_OPCODES; i++) {
+		if (strcmp(default_timing[i].opcode, opcode) == 0) {
+			timing = &default_timing[i];
+		}
+	}
+	if (timing->unit == UNIT_INT || timing->unit == UNIT_MUL) {
+		return unit == UNIT_INT || unit == UNIT_MUL;
+	}
+	return unit == timing->unit;
+}
+
+/*
+ * Starts machine from the built in timing and overrides the opcodes
+ * filename lists. Returns 1, naming the line, on a malformed entry.
+ */
+int
+machine_load(APEX_MACHINE* machine, const char* filename)
+{
+	FILE* fp = fopen(filename, "r");
+	if (!fp) {
+		fprintf(stderr, "APEX_Error : Unable to open machine description %s\n", filename);
+		return 1;
+	}
+	machine_init(machine);
+	char line[256];
+	int line_number = 0;
+	while (fgets(line, sizeof(line), fp)) {
+		line_number += 1;
+		line[strcspn(line, "#\r\n")] = '\0';
+		char opcode[16];
+		char unit_name[16];
+		int latency;
+		int interval = 1;
+		char extra;
+		int fields = sscanf(line, "%15s %15s %d %d %c", opcode, unit_name, &latency, &interval, &extra);
+		if (fields <= 0) {
+			continue;
+		}
+		OPCODE_TIMING* timing = (OPCODE_TIMING*) machine_timing(machine, opcode);
+		int unit = 0;
+		while (unit < NUM_UNITS && strcmp(unit_names[unit], unit_name) != 0) {
+			unit++;
+		}
+		const char* problem = NULL;
+		if (fields < 3 || fields > 4) {
+			problem = "expected <opcode> <unit> <latency> [<interval>]";
+		} else if (!timing) {
+			problem = "unknown opcode";
+		} else if (unit == NUM_UNITS || !unit_allowed(opcode, unit)) {
+			problem = "opcode cannot run on that unit";
+		} else if (latency < machine_unit_stages(unit) || latency > MACHINE_MAX_LATENCY) {
+			problem = "latency outside the unit's stages and the maximum";
+		} else if (interval < 1 || interval > MACHINE_MAX_LATENCY) {
+			problem = "interval must be between 1 and the maximum latency";
+		}
+		if (problem) {
+			fprintf(stderr, "APEX_Error : %s:%d: %s\n", filename, line_number, problem);
+			fclose(fp);
+			return 1;
+		}
+		timing->unit = unit;
+		timing->latency = latency;
+		timing->interval = interval;
+	}
+	fclose(fp);
+	return 0;
+}
@@ -0,0 +1,61 @@
+#ifndef _APEX_MACHINE_H_
+#define _APEX_MACHINE_H_
+/**
+ *  machine.h
+ *  Per opcode functional unit, latency and issue interval
+ *
+ *  A machine description file has one line per opcode,
+ *
+ *      <opcode> <unit> <latency> [<interval>]
+ *
+ *  with # starting a comment. ALU opcodes, MUL and their vector forms may
+ *  run on INT or MUL, BZ/BNZ/JUMP on BRANCH and the loads and stores on
+ *  MEM. Latency counts cycles from issue to the result for INT, MUL and
+ *  BRANCH, at least the 2, 3 and 1 stages each unit has, and the cycles
+ *  of the access in the LSQ for MEM, whose address always takes the 2
+ *  INT stages. The interval is how many cycles the unit waits before it
+ *  takes another instruction after this one, 1 for a fully pipelined
+ *  unit; MEM ignores it, the LSQ performs one access at a time. Opcodes
+ *  the file leaves out keep the built in timing, which is the hardwired
+ *  pipeline of the simulator.
+ */
+
+enum MACHINE_UNIT
+{
+	UNIT_INT,
+	UNIT_MUL,
+	UNIT_BRANCH,
+	UNIT_MEM,
+	NUM_UNITS
+};
+
+#define MACHINE_MAX_OPCODES 22
+#define MACHINE_MAX_LATENCY 16	// Bounds instructions waiting out their latency past a unit's last stage
+
+typedef struct OPCODE_TIMING
+{
+	char opcode[8];
+	int unit;		// enum MACHINE_UNIT
+	int latency;
+	int interval;
+} OPCODE_TIMING;
+
+typedef struct APEX_MACHINE
+{
+	OPCODE_TIMING ops[MACHINE_MAX_OPCODES];
+	int num_ops;
+} APEX_MACHINE;
+
+void
+machine_init(APEX_MACHINE* machine);
+
+int
+machine_load(APEX_MACHINE* machine, const char* filename);
+
+const OPCODE_TIMING*
+machine_timing(const APEX_MACHINE* machine, const char* opcode);
+
+int
+machine_unit_stages(int unit);
+
+#endif
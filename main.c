@@ -5,31 +5,462 @@
  *  Gaurav Kothari (gkothar1@binghamton.edu)
  *  State University of New York, Binghamton
  */
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <sys/resource.h>
 
 #include "cpu.h"
+#include "log.h"
+#include "multicore.h"
+#include "parallel.h"
+
+/* Watchdog used when running to HALT without a cycle budget */
+#define DEFAULT_WATCHDOG_CYCLES 1000
+
+/* One line on stderr for bench/run_bench.sh, kept out of the state dump */
+static void
+print_host_stats(struct timespec* start, int cycles, int retired)
+{
+  struct timespec end;
+  clock_gettime(CLOCK_MONOTONIC, &end);
+  double seconds = (end.tv_sec - start->tv_sec) + (end.tv_nsec - start->tv_nsec) / 1e9;
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+  fprintf(stderr, "APEX_Host : cycles=%d retired=%d seconds=%.6f cycles_per_sec=%.0f ipc=%.4f max_rss_kb=%ld\n",
+          cycles, retired, seconds, seconds > 0 ? cycles / seconds : 0.0,
+          cycles ? (double) retired / cycles : 0.0, usage.ru_maxrss);
+}
+
+/*
+ * --cores=<n>: input may name one program per core, comma separated,
+ * reused round robin when there are more cores than programs.
+ */
+static int
+run_multicore(const char* input, int cores, int quantum, int no_of_cycles, int watchdog,
+              const char* data_image, int host_stats, int load_speculation, const PREFETCH_CONFIG* prefetch,
+              const APEX_MACHINE* machine)
+{
+  char* list = strdup(input);
+  const char** files = malloc((strlen(input) / 2 + 1) * sizeof(char*));
+  if (!list || !files) {
+    fprintf(stderr, "APEX_Error : Out of memory\n");
+    exit(1);
+  }
+  int num_files = 0;
+  for (char* name = strtok(list, ","); name; name = strtok(NULL, ",")) {
+    files[num_files++] = name;
+  }
+  APEX_MULTICORE* system = multicore_init(files, num_files, cores);
+  if (!system) {
+    fprintf(stderr, "APEX_Error : Unable to initialize %d cores\n", cores);
+    exit(1);
+  }
+  if (data_image && mem_map_image(&system->memory, data_image)) {
+    fprintf(stderr, "APEX_Error : Unable to map data image %s\n", data_image);
+    exit(1);
+  }
+  for (int core = 0; core < cores; core++) {
+    system->cores[core]->load_speculation_enabled = load_speculation;
+    if (machine) {
+      system->cores[core]->machine = *machine;
+    }
+    if (prefetch && APEX_cpu_enable_prefetcher(system->cores[core], prefetch)) {
+      fprintf(stderr, "APEX_Error : Unable to set up the prefetcher\n");
+      exit(1);
+    }
+  }
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  int stuck = multicore_run(system, no_of_cycles, quantum, watchdog);
+  if (host_stats) {
+    int cycles = 0;
+    int retired = 0;
+    for (int core = 0; core < cores; core++) {
+      cycles = system->cores[core]->clock > cycles ? system->cores[core]->clock : cycles;
+      retired += system->cores[core]->ins_completed;
+    }
+    print_host_stats(&start, cycles, retired);
+  }
+  multicore_print(system);
+  multicore_stop(system);
+  free(files);
+  free(list);
+  return stuck;
+}
+
+/* Optional core features from the command line, set up the same way on every single core CPU a run creates */
+typedef struct CORE_OPTIONS
+{
+  const ICACHE_CONFIG* icache;  // NULL without --icache
+  const APEX_MACHINE* machine;  // NULL without --machine
+  int fusion;
+  int loop_buffer;
+  int move_elimination;
+  int value_prediction;
+  int load_speculation;
+} CORE_OPTIONS;
+
+/* Returns 1 if the I-cache cannot be set up */
+static int
+apply_core_options(APEX_CPU* cpu, const CORE_OPTIONS* options)
+{
+  cpu->fusion_enabled = options->fusion;
+  cpu->loop_buffer_enabled = options->loop_buffer;
+  cpu->move_elimination_enabled = options->move_elimination;
+  cpu->value_prediction_enabled = options->value_prediction;
+  cpu->load_speculation_enabled = options->load_speculation;
+  if (options->machine) {
+    cpu->machine = *options->machine;
+  }
+  return options->icache && APEX_cpu_enable_icache(cpu, options->icache);
+}
+
+/* IPC of file running alone, over at most cycles, as the SMT fairness reference */
+static double
+alone_ipc(const char* file, const CORE_OPTIONS* options, int cycles, int watchdog, const char* data_image)
+{
+  APEX_CPU* cpu = APEX_cpu_init(file);
+  if (!cpu || apply_core_options(cpu, options)
+      || (data_image && mem_map_image(&cpu->data_memory, data_image))) {
+    fprintf(stderr, "APEX_Error : Unable to initialize CPU for %s\n", file);
+    exit(1);
+  }
+  while (cpu->clock < cycles && !APEX_cpu_cycle(cpu)) {
+    if (watchdog && cpu->clock - cpu->last_commit_clock >= watchdog) {
+      break;
+    }
+  }
+  double ipc = cpu->clock ? (double) cpu->ins_completed / cpu->clock : 0.0;
+  APEX_cpu_stop(cpu);
+  return ipc;
+}
+
+/*
+ * --smt=<n>: like --cores, input may name one program per thread, comma
+ * separated. After the SMT run each program is run alone for as many
+ * cycles to weigh the per thread IPCs.
+ */
+static int
+run_smt(const char* input, int threads, int fetch_policy, const CORE_OPTIONS* options, int no_of_cycles, int watchdog,
+        const char* data_image, const char* interval_file, int interval_length, int simulate, int host_stats)
+{
+  char* list = strdup(input);
+  const char** files = malloc((strlen(input) / 2 + 1) * sizeof(char*));
+  if (!list || !files) {
+    fprintf(stderr, "APEX_Error : Out of memory\n");
+    exit(1);
+  }
+  int num_files = 0;
+  for (char* name = strtok(list, ","); name; name = strtok(NULL, ",")) {
+    files[num_files++] = name;
+  }
+  APEX_CPU* cpu = APEX_cpu_init(files[0]);
+  if (!cpu) {
+    fprintf(stderr, "APEX_Error : Unable to initialize CPU\n");
+    exit(1);
+  }
+  for (int t = 1; t < threads; t++) {
+    if (APEX_cpu_add_thread(cpu, files[t % num_files])) {
+      fprintf(stderr, "APEX_Error : Unable to add thread %d from %s\n", t, files[t % num_files]);
+      exit(1);
+    }
+  }
+  cpu->fetch_policy = fetch_policy;
+  if (apply_core_options(cpu, options)) {
+    fprintf(stderr, "APEX_Error : Unable to set up the I-cache\n");
+    exit(1);
+  }
+  cpu->watchdog_cycles = watchdog;
+  if (data_image && mem_map_image(&cpu->data_memory, data_image)) {
+    fprintf(stderr, "APEX_Error : Unable to map data image %s\n", data_image);
+    exit(1);
+  }
+  if (interval_file && open_interval_stats(cpu, interval_file, interval_length)) {
+    exit(1);
+  }
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  int stuck = APEX_cpu_run(cpu, no_of_cycles, simulate);
+  if (host_stats) {
+    print_host_stats(&start, cpu->clock, cpu->ins_completed);
+  }
+  double alone[APEX_MAX_THREADS];
+  for (int t = 0; t < threads; t++) {
+    APEX_THREAD* thread = &cpu->threads[t];
+    alone[t] = alone_ipc(files[t % num_files], options, thread->halted ? thread->halt_clock : cpu->clock, watchdog, data_image);
+  }
+  print_thread_stats(cpu, alone);
+  APEX_cpu_stop(cpu);
+  free(files);
+  free(list);
+  return stuck;
+}
+
+/*
+ * --checkpoints=<instructions>: the cycles argument caps the functional
+ * run in instructions instead, and the detailed model only simulates
+ * the checkpointed intervals.
+ */
+static int
+run_parallel(const char* file, long long max_instructions, int interval_length, int warmup, int watchdog,
+             const char* data_image, int host_stats)
+{
+  APEX_PARALLEL* sim = parallel_init(file, data_image, max_instructions, interval_length, warmup);
+  if (!sim) {
+    fprintf(stderr, "APEX_Error : Unable to checkpoint %s\n", file);
+    exit(1);
+  }
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  int stuck = parallel_run(sim, watchdog);
+  if (host_stats) {
+    int cycles = 0;
+    int retired = 0;
+    for (int i = 0; i < sim->num_intervals; i++) {
+      cycles += sim->intervals[i].cycles;
+      retired += sim->intervals[i].retired;
+    }
+    print_host_stats(&start, cycles, retired);
+  }
+  int incomplete = parallel_print(sim);
+  parallel_stop(sim);
+  return stuck || incomplete;
+}
 
 int
 main(int argc, char const* argv[])
 {
-  if (argc != 4) {
-    fprintf(stderr, "APEX_Help : Usage %s <input_file> function cycles\n", argv[0]);
+  if (argc < 4) {
+    fprintf(stderr, "APEX_Help : Usage %s <input_file> function <cycles|halt> [--profile=<file>] [--interval=<cycles>,<file>] [--trace=<file>]\n"
+            "           [--log=<subsystem>:<level>,...] [--log-file=<file>] [--host-stats]\n"
+            "           [--data-image=<file>] [--watchdog=<cycles>] [--cores=<n>] [--quantum=<cycles>]\n"
+            "           [--smt=<n>] [--fetch-policy=rr|icount] [--checkpoints=<instructions>] [--warmup=<instructions>]\n"
+            "           [--icache[=<sets>,<ways>,<line words>,<miss cycles>]] [--fusion] [--loop-buffer]\n"
+            "           [--move-elimination] [--value-prediction] [--load-speculation] [--prefetch=next-line|stride[,<degree>,<distance>]]\n"
+            "           [--machine=<file>]\n", argv[0]);
     exit(1);
   }
-  int no_of_cycles = strtol(argv[3], NULL, 0);
+  const char* profile_file = NULL;
+  const char* interval_file = NULL;
+  const char* trace_file = NULL;
+  const char* data_image = NULL;
+  const char* log_spec = NULL;
+  int interval_length = 0;
+  int host_stats = 0;
+  int watchdog = -1;
+  int cores = 1;
+  int quantum = 64;
+  int smt = 1;
+  int fetch_policy = FETCH_ROUND_ROBIN;
+  int checkpoint_interval = 0;
+  int warmup = 1000;
+  ICACHE_CONFIG icache = {ICACHE_SETS, ICACHE_WAYS, ICACHE_LINE_WORDS, ICACHE_MISS_LATENCY};
+  int use_icache = 0;
+  PREFETCH_CONFIG prefetch = {PREFETCH_NEXT_LINE, PREFETCH_DEGREE, PREFETCH_DISTANCE};
+  int use_prefetch = 0;
+  APEX_MACHINE machine;
+  CORE_OPTIONS options = {NULL, NULL, 0, 0, 0, 0};
+  for (int i = 4; i < argc; ++i) {
+    if (strncmp(argv[i], "--profile=", 10) == 0) {
+      profile_file = argv[i] + 10;
+    } else if (strncmp(argv[i], "--log-file=", 11) == 0) {
+      if (log_open_sink(argv[i] + 11)) {
+        fprintf(stderr, "APEX_Error : Unable to open log file %s\n", argv[i] + 11);
+        exit(1);
+      }
+    } else if (strncmp(argv[i], "--log=", 6) == 0) {
+      log_spec = argv[i] + 6;
+    } else if (strncmp(argv[i], "--trace=", 8) == 0) {
+      trace_file = argv[i] + 8;
+    } else if (strncmp(argv[i], "--data-image=", 13) == 0) {
+      data_image = argv[i] + 13;
+    } else if (strncmp(argv[i], "--watchdog=", 11) == 0) {
+      watchdog = strtol(argv[i] + 11, NULL, 0);
+    } else if (strncmp(argv[i], "--cores=", 8) == 0) {
+      cores = strtol(argv[i] + 8, NULL, 0);
+    } else if (strncmp(argv[i], "--quantum=", 10) == 0) {
+      quantum = strtol(argv[i] + 10, NULL, 0);
+    } else if (strncmp(argv[i], "--smt=", 6) == 0) {
+      smt = strtol(argv[i] + 6, NULL, 0);
+    } else if (strcmp(argv[i], "--fetch-policy=rr") == 0) {
+      fetch_policy = FETCH_ROUND_ROBIN;
+    } else if (strcmp(argv[i], "--fetch-policy=icount") == 0) {
+      fetch_policy = FETCH_ICOUNT;
+    } else if (strncmp(argv[i], "--checkpoints=", 14) == 0) {
+      checkpoint_interval = strtol(argv[i] + 14, NULL, 0);
+    } else if (strncmp(argv[i], "--warmup=", 9) == 0) {
+      warmup = strtol(argv[i] + 9, NULL, 0);
+    } else if (strcmp(argv[i], "--icache") == 0) {
+      use_icache = 1;
+    } else if (strncmp(argv[i], "--icache=", 9) == 0) {
+      char* end;
+      use_icache = 1;
+      icache.sets = strtol(argv[i] + 9, &end, 0);
+      icache.ways = *end == ',' ? strtol(end + 1, &end, 0) : 0;
+      icache.line_words = *end == ',' ? strtol(end + 1, &end, 0) : 0;
+      icache.miss_latency = *end == ',' ? strtol(end + 1, &end, 0) : -1;
+      if (*end != '\0' || icache.sets < 1 || icache.ways < 1 || icache.line_words < 1 || icache.miss_latency < 0) {
+        fprintf(stderr, "APEX_Error : Expected --icache=<sets>,<ways>,<line words>,<miss cycles>\n");
+        exit(1);
+      }
+    } else if (strcmp(argv[i], "--fusion") == 0) {
+      options.fusion = 1;
+    } else if (strcmp(argv[i], "--loop-buffer") == 0) {
+      options.loop_buffer = 1;
+    } else if (strcmp(argv[i], "--move-elimination") == 0) {
+      options.move_elimination = 1;
+    } else if (strcmp(argv[i], "--value-prediction") == 0) {
+      options.value_prediction = 1;
+    } else if (strcmp(argv[i], "--load-speculation") == 0) {
+      options.load_speculation = 1;
+    } else if (strncmp(argv[i], "--prefetch=", 11) == 0) {
+      const char* kind = argv[i] + 11;
+      char* end;
+      use_prefetch = 1;
+      if (strncmp(kind, "next-line", 9) == 0) {
+        prefetch.kind = PREFETCH_NEXT_LINE;
+        end = (char*) kind + 9;
+      } else if (strncmp(kind, "stride", 6) == 0) {
+        prefetch.kind = PREFETCH_STRIDE;
+        end = (char*) kind + 6;
+      } else {
+        end = (char*) kind;
+      }
+      if (*end == ',') {
+        prefetch.degree = strtol(end + 1, &end, 0);
+        prefetch.distance = *end == ',' ? strtol(end + 1, &end, 0) : 0;
+      }
+      if (end == kind || *end != '\0' || prefetch.degree < 1 || prefetch.distance < 1) {
+        fprintf(stderr, "APEX_Error : Expected --prefetch=next-line|stride[,<degree>,<distance>]\n");
+        exit(1);
+      }
+    } else if (strncmp(argv[i], "--machine=", 10) == 0) {
+      if (machine_load(&machine, argv[i] + 10)) {
+        exit(1);
+      }
+      options.machine = &machine;
+    } else if (strcmp(argv[i], "--host-stats") == 0) {
+      host_stats = 1;
+    } else if (strncmp(argv[i], "--interval=", 11) == 0) {
+      char* end;
+      interval_length = strtol(argv[i] + 11, &end, 0);
+      if (*end != ',' || interval_length <= 0) {
+        fprintf(stderr, "APEX_Error : Expected --interval=<cycles>,<file>\n");
+        exit(1);
+      }
+      interval_file = end + 1;
+    } else {
+      fprintf(stderr, "APEX_Error : Unknown option %s\n", argv[i]);
+      exit(1);
+    }
+  }
+  /* "halt" runs until HALT commits, with the watchdog on by default */
+  int no_of_cycles;
+  if (strcmp(argv[3], "halt") == 0) {
+    no_of_cycles = INT_MAX;
+    if (watchdog < 0) {
+      watchdog = DEFAULT_WATCHDOG_CYCLES;
+    }
+  } else {
+    no_of_cycles = strtol(argv[3], NULL, 0);
+  }
   const char* function = argv[2];
   int simulate = 0;
   if(strcmp(function, "simulate") == 0) {
     simulate = 1;
   }
+  if (simulate) {
+    log_set_all_levels(LOG_DEBUG);
+  }
+  if (log_spec && log_parse_levels(log_spec)) {
+    fprintf(stderr, "APEX_Error : Bad --log spec %s, expected <subsystem>:<level>,...\n", log_spec);
+    exit(1);
+  }
+  if (cores < 1 || quantum < 1) {
+    fprintf(stderr, "APEX_Error : --cores and --quantum must be at least 1\n");
+    exit(1);
+  }
+  if (smt < 1 || smt > APEX_MAX_THREADS) {
+    fprintf(stderr, "APEX_Error : --smt must be between 1 and %d\n", APEX_MAX_THREADS);
+    exit(1);
+  }
+  if (checkpoint_interval < 0 || warmup < 0) {
+    fprintf(stderr, "APEX_Error : --checkpoints and --warmup must not be negative\n");
+    exit(1);
+  }
+  if (use_icache) {
+    options.icache = &icache;
+  }
+  int core_options = use_icache || options.fusion || options.loop_buffer || options.move_elimination || options.value_prediction;
+  if (checkpoint_interval > 0) {
+    /* Intervals run out of order on host threads, so there is no single timeline to dump or trace */
+    if (smt > 1 || cores > 1 || simulate || trace_file || interval_file || profile_file || core_options || options.load_speculation
+        || use_prefetch || options.machine) {
+      fprintf(stderr, "APEX_Error : --checkpoints needs a single core and thread without simulate, --trace, --interval, --profile, --icache, --fusion, --loop-buffer, --move-elimination, --value-prediction, --load-speculation, --prefetch or --machine\n");
+      exit(1);
+    }
+    int stuck = run_parallel(argv[1], no_of_cycles, checkpoint_interval, warmup,
+                             watchdog > 0 ? watchdog : DEFAULT_WATCHDOG_CYCLES, data_image, host_stats);
+    log_close();
+    return stuck ? 1 : 0;
+  }
+  if (smt > 1) {
+    /* Profiles and traces are keyed by PC, which the threads' programs share */
+    if (cores > 1 || trace_file || profile_file || use_prefetch) {
+      fprintf(stderr, "APEX_Error : --cores, --prefetch, --trace and --profile need a single thread\n");
+      exit(1);
+    }
+    int stuck = run_smt(argv[1], smt, fetch_policy, &options, no_of_cycles, watchdog > 0 ? watchdog : 0, data_image,
+                        interval_file, interval_length, simulate, host_stats);
+    log_close();
+    return stuck ? 1 : 0;
+  }
+  /* Only the multi-core system has data caches, so --prefetch runs even one core through it */
+  if (cores > 1 || use_prefetch) {
+    /* Per cycle dumps, traces and per core profiles would interleave across host threads */
+    if (simulate || trace_file || interval_file || profile_file || core_options) {
+      fprintf(stderr, "APEX_Error : simulate, --trace, --interval, --profile, --icache, --fusion, --loop-buffer, --move-elimination and --value-prediction need a single core without --prefetch\n");
+      exit(1);
+    }
+    int stuck = run_multicore(argv[1], cores, quantum, no_of_cycles, watchdog > 0 ? watchdog : 0, data_image, host_stats,
+                              options.load_speculation, use_prefetch ? &prefetch : NULL, options.machine);
+    log_close();
+    return stuck ? 1 : 0;
+  }
   APEX_CPU* cpu = APEX_cpu_init(argv[1]);
   if (!cpu) {
     fprintf(stderr, "APEX_Error : Unable to initialize CPU\n");
     exit(1);
   }
-  APEX_cpu_run(cpu, no_of_cycles, simulate);
+  cpu->watchdog_cycles = watchdog > 0 ? watchdog : 0;
+  if (apply_core_options(cpu, &options)) {
+    fprintf(stderr, "APEX_Error : Unable to set up the I-cache\n");
+    exit(1);
+  }
+  if (data_image && mem_map_image(&cpu->data_memory, data_image)) {
+    fprintf(stderr, "APEX_Error : Unable to map data image %s\n", data_image);
+    exit(1);
+  }
+  if (interval_file && open_interval_stats(cpu, interval_file, interval_length)) {
+    exit(1);
+  }
+  if (trace_file && !(cpu->trace = trace_open(trace_file))) {
+    fprintf(stderr, "APEX_Error : Unable to open trace file %s\n", trace_file);
+    exit(1);
+  }
+  struct timespec start;
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  int stuck = APEX_cpu_run(cpu, no_of_cycles, simulate);
+  if (host_stats) {
+    print_host_stats(&start, cpu->clock, cpu->ins_completed);
+  }
+  if (profile_file) {
+    write_pc_profile(cpu, profile_file);
+  }
   APEX_cpu_stop(cpu);
-  return 0;
+  log_close();
+  return stuck ? 1 : 0;
 }
\ No newline at end of file
@@ -0,0 +1,167 @@
+/*
+ *  memory.c
+ *  Page allocation, dirty tracking and image mapping for the data memory
+ */
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "memory.h"
+
+/* A simulated store has nowhere to report failure, so running out of host memory is fatal */
+static void*
+mem_calloc(size_t count, size_t size)
+{
+	void* block = calloc(count, size);
+	if (!block) {
+		fprintf(stderr, "APEX_Error : Out of memory allocating data memory pages\n");
+		exit(1);
+	}
+	return block;
+}
+
+/*
+ * Returns the page, giving it storage first if needed: pages that lie
+ * wholly inside the image point into the mapping, anything else gets a
+ * fresh page seeded from whatever part of the image it overlaps.
+ */
+MEM_PAGE*
+mem_lookup_page(APEX_MEMORY* mem, uint32_t page_number)
+{
+	MEM_PAGE** table = &mem->directory[page_number >> MEM_TABLE_BITS];
+	if (!*table) {
+		*table = mem_calloc(MEM_TABLE_SIZE, sizeof(MEM_PAGE));
+	}
+	MEM_PAGE* page = &(*table)[page_number & (MEM_TABLE_SIZE - 1)];
+	if (page->words) {
+		return page;
+	}
+	size_t first_word = (size_t) page_number << MEM_PAGE_BITS;
+	if (first_word + MEM_PAGE_WORDS <= mem->image_words) {
+		page->words = mem->image + first_word;
+		page->mapped = 1;
+		return page;
+	}
+	page->words = mem_calloc(MEM_PAGE_WORDS, sizeof(int));
+	if (first_word < mem->image_words) {
+		memcpy(page->words, mem->image + first_word, (mem->image_words - first_word) * sizeof(int));
+	}
+	mem->pages_allocated += 1;
+	return page;
+}
+
+void
+mem_mark_dirty(APEX_MEMORY* mem, MEM_PAGE* page, uint32_t page_number)
+{
+	if (mem->dirty_count == mem->dirty_capacity) {
+		mem->dirty_capacity = mem->dirty_capacity ? 2 * mem->dirty_capacity : 64;
+		mem->dirty_pages = realloc(mem->dirty_pages, mem->dirty_capacity * sizeof(uint32_t));
+		if (!mem->dirty_pages) {
+			fprintf(stderr, "APEX_Error : Out of memory tracking dirty pages\n");
+			exit(1);
+		}
+	}
+	mem->dirty_pages[mem->dirty_count++] = page_number;
+	page->dirty = 1;
+}
+
+/*
+ * Maps filename, raw native endian 32 bit words, at word address 0. The
+ * mapping is private, so the file itself is never modified.
+ */
+int
+mem_map_image(APEX_MEMORY* mem, const char* filename)
+{
+	int fd = open(filename, O_RDONLY);
+	if (fd < 0) {
+		return 1;
+	}
+	struct stat st;
+	if (fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(int)) {
+		close(fd);
+		return 1;
+	}
+	void* image = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (image == MAP_FAILED) {
+		return 1;
+	}
+	mem->image = image;
+	mem->image_bytes = st.st_size;
+	mem->image_words = st.st_size / sizeof(int);
+	return 0;
+}
+
+static int
+compare_page_numbers(const void* a, const void* b)
+{
+	uint32_t left = *(const uint32_t*) a;
+	uint32_t right = *(const uint32_t*) b;
+	return (left > right) - (left < right);
+}
+
+/* Puts dirty_pages in address order, for dumps */
+void
+mem_sort_dirty_pages(APEX_MEMORY* mem)
+{
+	// A memory never stored to may have no dirty_pages array at all
+	if (mem->dirty_count == 0) {
+		return;
+	}
+	qsort(mem->dirty_pages, mem->dirty_count, sizeof(uint32_t), compare_page_numbers);
+}
+
+/* Storage of an already touched page, NULL if it has none */
+int*
+mem_page_words(APEX_MEMORY* mem, uint32_t page_number)
+{
+	MEM_PAGE* table = mem->directory[page_number >> MEM_TABLE_BITS];
+	return table ? table[page_number & (MEM_TABLE_SIZE - 1)].words : NULL;
+}
+
+/*
+ * Copies every page src has stored to into dst, on top of whatever dst
+ * already holds (typically the same image, mapped separately).
+ */
+void
+mem_copy_dirty_pages(APEX_MEMORY* dst, APEX_MEMORY* src)
+{
+	for (int i = 0; i < src->dirty_count; i++) {
+		uint32_t page_number = src->dirty_pages[i];
+		MEM_PAGE* page = mem_lookup_page(dst, page_number);
+		if (!page->dirty) {
+			mem_mark_dirty(dst, page, page_number);
+		}
+		memcpy(page->words, mem_page_words(src, page_number), MEM_PAGE_WORDS * sizeof(int));
+	}
+}
+
+void
+mem_free(APEX_MEMORY* mem)
+{
+	for (uint32_t i = 0; i < MEM_DIRECTORY_SIZE; i++) {
+		MEM_PAGE* table = mem->directory[i];
+		if (!table) {
+			continue;
+		}
+		for (uint32_t j = 0; j < MEM_TABLE_SIZE; j++) {
+			if (!table[j].mapped) {
+				free(table[j].words);
+			}
+		}
+		free(table);
+		mem->directory[i] = NULL;
+	}
+	free(mem->dirty_pages);
+	mem->dirty_pages = NULL;
+	mem->dirty_count = mem->dirty_capacity = mem->pages_allocated = 0;
+	if (mem->image) {
+		munmap(mem->image, mem->image_bytes);
+		mem->image = NULL;
+		mem->image_words = mem->image_bytes = 0;
+	}
+}
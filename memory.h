@@ -0,0 +1,131 @@
+#ifndef _APEX_MEMORY_H_
+#define _APEX_MEMORY_H_
+/**
+ *  memory.h
+ *  Sparse, paged data memory covering the full 32 bit word address space
+ *
+ *  Addresses are word indices, as computed by LOAD/STORE. A two level
+ *  table maps them to 1024 word pages that are only allocated on the
+ *  first store, so untouched memory reads as zero and costs nothing.
+ *  Stored-to pages are remembered in a dirty list for dumps and
+ *  snapshots. An initial data image can be mmapped in; its pages are
+ *  read straight from the mapping, and stores land in private copy on
+ *  write pages.
+ */
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define MEM_PAGE_BITS 10
+#define MEM_TABLE_BITS 10
+#define MEM_DIRECTORY_BITS (32 - MEM_TABLE_BITS - MEM_PAGE_BITS)
+#define MEM_PAGE_WORDS (1u << MEM_PAGE_BITS)
+#define MEM_TABLE_SIZE (1u << MEM_TABLE_BITS)
+#define MEM_DIRECTORY_SIZE (1u << MEM_DIRECTORY_BITS)
+
+typedef struct MEM_PAGE
+{
+	int* words;		// NULL until first touched
+	int dirty;
+	int mapped;		// words point into the image mapping, not owned
+} MEM_PAGE;
+
+typedef struct APEX_MEMORY
+{
+	MEM_PAGE* directory[MEM_DIRECTORY_SIZE];	// Each a table of MEM_TABLE_SIZE pages
+	uint32_t* dirty_pages;	// Page numbers, in first store order until sorted
+	int dirty_count;
+	int dirty_capacity;
+	int pages_allocated;
+	/* Initial image, mapped read/write private so stores never reach the file */
+	int* image;
+	size_t image_words;
+	size_t image_bytes;
+} APEX_MEMORY;
+
+MEM_PAGE*
+mem_lookup_page(APEX_MEMORY* mem, uint32_t page_number);
+
+void
+mem_mark_dirty(APEX_MEMORY* mem, MEM_PAGE* page, uint32_t page_number);
+
+static inline int
+mem_read(APEX_MEMORY* mem, uint32_t address)
+{
+	MEM_PAGE* table = mem->directory[address >> (MEM_TABLE_BITS + MEM_PAGE_BITS)];
+	if (table) {
+		MEM_PAGE* page = &table[(address >> MEM_PAGE_BITS) & (MEM_TABLE_SIZE - 1)];
+		if (page->words) {
+			return page->words[address & (MEM_PAGE_WORDS - 1)];
+		}
+	}
+	if (address < mem->image_words) {
+		return mem->image[address];
+	}
+	return 0;
+}
+
+static inline void
+mem_write(APEX_MEMORY* mem, uint32_t address, int value)
+{
+	uint32_t page_number = address >> MEM_PAGE_BITS;
+	MEM_PAGE* page = mem_lookup_page(mem, page_number);
+	if (!page->dirty) {
+		mem_mark_dirty(mem, page, page_number);
+	}
+	page->words[address & (MEM_PAGE_WORDS - 1)] = value;
+}
+
+/* Reads count words from address on, one block copy when they share a page */
+static inline void
+mem_read_words(APEX_MEMORY* mem, uint32_t address, int* words, int count)
+{
+	uint32_t offset = address & (MEM_PAGE_WORDS - 1);
+	MEM_PAGE* table = mem->directory[address >> (MEM_TABLE_BITS + MEM_PAGE_BITS)];
+	if (table && offset + count <= MEM_PAGE_WORDS) {
+		MEM_PAGE* page = &table[(address >> MEM_PAGE_BITS) & (MEM_TABLE_SIZE - 1)];
+		if (page->words) {
+			memcpy(words, &page->words[offset], count * sizeof(int));
+			return;
+		}
+	}
+	for (int i = 0; i < count; i++) {
+		words[i] = mem_read(mem, address + i);
+	}
+}
+
+/* Writes count words from address on, one block copy when they share a page */
+static inline void
+mem_write_words(APEX_MEMORY* mem, uint32_t address, const int* words, int count)
+{
+	uint32_t offset = address & (MEM_PAGE_WORDS - 1);
+	if (offset + count > MEM_PAGE_WORDS) {
+		for (int i = 0; i < count; i++) {
+			mem_write(mem, address + i, words[i]);
+		}
+		return;
+	}
+	uint32_t page_number = address >> MEM_PAGE_BITS;
+	MEM_PAGE* page = mem_lookup_page(mem, page_number);
+	if (!page->dirty) {
+		mem_mark_dirty(mem, page, page_number);
+	}
+	memcpy(&page->words[offset], words, count * sizeof(int));
+}
+
+int
+mem_map_image(APEX_MEMORY* mem, const char* filename);
+
+void
+mem_sort_dirty_pages(APEX_MEMORY* mem);
+
+int*
+mem_page_words(APEX_MEMORY* mem, uint32_t page_number);
+
+void
+mem_copy_dirty_pages(APEX_MEMORY* dst, APEX_MEMORY* src);
+
+void
+mem_free(APEX_MEMORY* mem);
+
+#endif
@@ -0,0 +1,215 @@
+/*
+ *  multicore.c
+ *  Builds and runs a multi-core APEX system on parallel host threads
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "multicore.h"
+
+typedef struct CORE_THREAD
+{
+	APEX_MULTICORE* system;
+	int first_core;		// Thread runs cores first_core, first_core + num_threads, ...
+	int watchdog_cycles;
+} CORE_THREAD;
+
+/*
+ * Core i runs filenames[i % num_files], so one program can be replicated
+ * or every core given its own.
+ */
+APEX_MULTICORE*
+multicore_init(const char** filenames, int num_files, int num_cores)
+{
+	if (num_files < 1 || num_cores < 1) {
+		return NULL;
+	}
+	APEX_MULTICORE* system = calloc(1, sizeof(*system));
+	if (!system) {
+		return NULL;
+	}
+	system->num_cores = num_cores;
+	system->cores = calloc(num_cores, sizeof(APEX_CPU*));
+	system->stuck = calloc(num_cores, sizeof(int));
+	system->caches = calloc(num_cores, sizeof(L1_CACHE));
+	if (!system->cores || !system->stuck || !system->caches
+	    || coherence_init(&system->bus, &system->memory, system->caches, num_cores)) {
+		free(system->cores);
+		free(system->stuck);
+		free(system->caches);
+		free(system);
+		return NULL;
+	}
+	for (int i = 0; i < num_cores; i++) {
+		system->cores[i] = APEX_cpu_init(filenames[i % num_files]);
+		if (!system->cores[i]) {
+			fprintf(stderr, "APEX_Error : Unable to initialize core %d from %s\n", i, filenames[i % num_files]);
+			multicore_stop(system);
+			return NULL;
+		}
+		system->cores[i]->l1 = &system->caches[i];
+	}
+	return system;
+}
+
+static int
+core_finished(APEX_MULTICORE* system, int core)
+{
+	APEX_CPU* cpu = system->cores[core];
+	return cpu->halted || system->stuck[core] || cpu->clock >= system->no_of_cycles;
+}
+
+static void*
+run_core_thread(void* arg)
+{
+	CORE_THREAD* thread = arg;
+	APEX_MULTICORE* system = thread->system;
+	for (;;) {
+		for (int core = thread->first_core; core < system->num_cores; core += system->num_threads) {
+			APEX_CPU* cpu = system->cores[core];
+			for (int cycle = 0; cycle < system->quantum && !core_finished(system, core); cycle++) {
+				if (APEX_cpu_cycle(cpu)) {
+					break;
+				}
+				if (thread->watchdog_cycles && cpu->clock - cpu->last_commit_clock >= thread->watchdog_cycles) {
+					system->stuck[core] = 1;
+					pthread_mutex_lock(&system->report_lock);
+					fprintf(stderr, "APEX_Error : Core %d committed nothing for %d cycles, stopping it at cycle %d\n",
+						core, thread->watchdog_cycles, cpu->clock);
+					print_watchdog_snapshot(cpu, stderr);
+					pthread_mutex_unlock(&system->report_lock);
+				}
+			}
+		}
+		// One thread decides whether everyone is done while the others wait
+		if (pthread_barrier_wait(&system->barrier) == PTHREAD_BARRIER_SERIAL_THREAD) {
+			int done = 1;
+			for (int core = 0; core < system->num_cores; core++) {
+				done = done && core_finished(system, core);
+			}
+			system->done = done;
+		}
+		pthread_barrier_wait(&system->barrier);
+		if (system->done) {
+			return NULL;
+		}
+	}
+}
+
+/*
+ * Runs every core until it commits HALT, reaches no_of_cycles or trips
+ * the watchdog. Returns 1 if any core was stopped by the watchdog.
+ */
+int
+multicore_run(APEX_MULTICORE* system, int no_of_cycles, int quantum, int watchdog_cycles)
+{
+	long host_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	system->num_threads = system->num_cores < host_cpus ? system->num_cores : (host_cpus > 0 ? host_cpus : 1);
+	system->quantum = quantum > 0 ? quantum : 1;
+	system->no_of_cycles = no_of_cycles;
+	system->done = 0;
+	pthread_mutex_init(&system->report_lock, NULL);
+	pthread_barrier_init(&system->barrier, NULL, system->num_threads);
+
+	pthread_t* handles = malloc(system->num_threads * sizeof(pthread_t));
+	CORE_THREAD* threads = malloc(system->num_threads * sizeof(CORE_THREAD));
+	if (!handles || !threads) {
+		fprintf(stderr, "APEX_Error : Out of memory starting core threads\n");
+		exit(1);
+	}
+	for (int i = 0; i < system->num_threads; i++) {
+		threads[i].system = system;
+		threads[i].first_core = i;
+		threads[i].watchdog_cycles = watchdog_cycles;
+	}
+	// Thread 0 is the calling thread
+	for (int i = 1; i < system->num_threads; i++) {
+		if (pthread_create(&handles[i], NULL, run_core_thread, &threads[i]) != 0) {
+			fprintf(stderr, "APEX_Error : Unable to start core thread %d\n", i);
+			exit(1);
+		}
+	}
+	run_core_thread(&threads[0]);
+	for (int i = 1; i < system->num_threads; i++) {
+		pthread_join(handles[i], NULL);
+	}
+	free(handles);
+	free(threads);
+	pthread_barrier_destroy(&system->barrier);
+	pthread_mutex_destroy(&system->report_lock);
+
+	int stuck = 0;
+	for (int core = 0; core < system->num_cores; core++) {
+		stuck = stuck || system->stuck[core];
+	}
+	return stuck;
+}
+
+void
+multicore_print(APEX_MULTICORE* system)
+{
+	printf("(apex) >> Simulation Complete, %d cores on %d host threads, quantum %d\n",
+	       system->num_cores, system->num_threads, system->quantum);
+	int retired = 0;
+	int cycles = 0;
+	for (int core = 0; core < system->num_cores; core++) {
+		printf("=============== CORE %d =============\n", core);
+		print_register_state(system->cores[core]);
+	}
+	print_memory(&system->memory);
+	printf("============== PER CORE IPC AND COHERENCE TRAFFIC =============\n");
+	for (int core = 0; core < system->num_cores; core++) {
+		APEX_CPU* cpu = system->cores[core];
+		COHERENCE_STATS* stats = &system->caches[core].stats;
+		retired += cpu->ins_completed;
+		cycles = cpu->clock > cycles ? cpu->clock : cycles;
+		printf("| \t CORE[%d] \t | \t Cycles=%d \t | \t Retired=%d \t | \t IPC=%.3f \t | \t %s \t |\n", core,
+		       cpu->clock, cpu->ins_completed, cpu->clock ? (double) cpu->ins_completed / cpu->clock : 0.0,
+		       cpu->halted ? "HALTED" : (system->stuck[core] ? "STUCK" : "CYCLE LIMIT"));
+		printf("| \t CORE[%d] L1 \t | \t Hits=%d \t | \t Misses=%d \t | \t BusRd=%d \t | \t BusRdX=%d \t | \t BusUpgr=%d \t |"
+		       " \t Inv sent=%d \t | \t Inv received=%d \t | \t Writebacks=%d \t | \t Cache to cache=%d \t |\n", core,
+		       stats->hits, stats->misses, stats->bus_reads, stats->bus_read_exclusives, stats->bus_upgrades,
+		       stats->invalidations_sent, stats->invalidations_received, stats->writebacks, stats->cache_to_cache);
+		if (cpu->load_speculation_enabled) {
+			printf("| \t CORE[%d] LOAD SPECULATION \t | \t Loads=%d \t | \t Replays=%d \t | \t Early issues=%d \t |"
+			       " \t Wasted issues=%d \t |\n", core, cpu->spec_loads, cpu->spec_replays, cpu->spec_early_issues,
+			       cpu->spec_wasted_issues);
+		}
+		if (cpu->prefetcher) {
+			int useful = stats->useful_prefetches;
+			printf("| \t CORE[%d] PREFETCH %s \t | \t Requests=%d \t | \t Prefetches=%d \t | \t Useful=%d \t | \t Late=%d \t |"
+			       " \t Accuracy=%.1f%% \t | \t Coverage=%.1f%% \t | \t Timeliness=%.1f%% \t |\n", core,
+			       prefetch_kind_name(cpu->prefetcher->config.kind), cpu->prefetcher->requests, stats->prefetches,
+			       useful, stats->late_prefetches, stats->prefetches ? 100.0 * useful / stats->prefetches : 0.0,
+			       useful + stats->misses ? 100.0 * useful / (useful + stats->misses) : 0.0,
+			       useful ? 100.0 * (useful - stats->late_prefetches) / useful : 0.0);
+		}
+	}
+	printf("| \t SYSTEM \t | \t Cycles=%d \t | \t Retired=%d \t | \t IPC=%.3f \t |\n", cycles, retired,
+	       cycles ? (double) retired / cycles : 0.0);
+#ifdef APEX_STAGE_PROFILE
+	// Each core counted on its own host thread
+	STAGE_PROFILE stage_profile = {{0}};
+	for (int core = 0; core < system->num_cores; core++) {
+		stage_profile_add(&stage_profile, &system->cores[core]->stage_profile);
+	}
+	print_stage_profile(&stage_profile);
+#endif
+}
+
+void
+multicore_stop(APEX_MULTICORE* system)
+{
+	for (int core = 0; core < system->num_cores; core++) {
+		if (system->cores[core]) {
+			APEX_cpu_stop(system->cores[core]);
+		}
+	}
+	coherence_destroy(&system->bus);
+	mem_free(&system->memory);
+	free(system->cores);
+	free(system->stuck);
+	free(system->caches);
+	free(system);
+}
@@ -0,0 +1,47 @@
+#ifndef _APEX_MULTICORE_H_
+#define _APEX_MULTICORE_H_
+/**
+ *  multicore.h
+ *  N APEX cores sharing one data memory through coherent private L1s
+ *
+ *  Each core is a full APEX_CPU pipeline. Cores are spread over up to
+ *  one host thread per host CPU and run quantum cycles between barriers,
+ *  so no core gets more than quantum cycles ahead of another. A quantum
+ *  of 1 is lockstep.
+ */
+#include <pthread.h>
+
+#include "coherence.h"
+#include "cpu.h"
+
+typedef struct APEX_MULTICORE
+{
+	int num_cores;
+	APEX_CPU** cores;
+	int* stuck;		// Core stopped by its watchdog
+	L1_CACHE* caches;
+	COHERENCE_BUS bus;
+	APEX_MEMORY memory;	// Shared data memory
+
+	/* Run state shared by the host threads */
+	int num_threads;
+	int quantum;
+	int no_of_cycles;
+	int done;
+	pthread_barrier_t barrier;
+	pthread_mutex_t report_lock;
+} APEX_MULTICORE;
+
+APEX_MULTICORE*
+multicore_init(const char** filenames, int num_files, int num_cores);
+
+int
+multicore_run(APEX_MULTICORE* system, int no_of_cycles, int quantum, int watchdog_cycles);
+
+void
+multicore_print(APEX_MULTICORE* system);
+
+void
+multicore_stop(APEX_MULTICORE* system);
+
+#endif
@@ -0,0 +1,252 @@
+/*
+ *  parallel.c
+ *  Functional checkpointing and parallel detailed simulation of intervals
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "parallel.h"
+
+/*
+ * Fast forwards filename functionally for up to max_instructions,
+ * checkpointing warmup instructions ahead of every interval_length
+ * boundary. Intervals the program halts before reaching are dropped.
+ */
+APEX_PARALLEL*
+parallel_init(const char* filename, const char* data_image, long long max_instructions,
+	      int interval_length, int warmup)
+{
+	if (interval_length < 1 || warmup < 0) {
+		return NULL;
+	}
+	APEX_PARALLEL* sim = calloc(1, sizeof(*sim));
+	if (!sim) {
+		return NULL;
+	}
+	sim->filename = filename;
+	sim->data_image = data_image;
+	APEX_FUNCTIONAL* func = &sim->functional;
+	if (functional_init(func, filename)) {
+		free(sim);
+		return NULL;
+	}
+	if (data_image && mem_map_image(&func->memory, data_image)) {
+		fprintf(stderr, "APEX_Error : Unable to map data image %s\n", data_image);
+		parallel_stop(sim);
+		return NULL;
+	}
+	int capacity = 0;
+	for (long long start = 0; start < max_instructions; start += interval_length) {
+		long long checkpoint_at = start > warmup ? start - warmup : 0;
+		functional_run(func, checkpoint_at - func->instructions);
+		if (func->halted) {
+			break;
+		}
+		if (sim->num_intervals == capacity) {
+			capacity = capacity ? 2 * capacity : 16;
+			APEX_INTERVAL* intervals = realloc(sim->intervals, capacity * sizeof(APEX_INTERVAL));
+			if (!intervals) {
+				fprintf(stderr, "APEX_Error : Out of memory checkpointing %s\n", filename);
+				parallel_stop(sim);
+				return NULL;
+			}
+			sim->intervals = intervals;
+		}
+		APEX_INTERVAL* interval = &sim->intervals[sim->num_intervals++];
+		memset(interval, 0, sizeof(*interval));
+		functional_checkpoint(func, &interval->checkpoint);
+		interval->start = start;
+		interval->warmup = (int) (start - checkpoint_at);
+		interval->length = max_instructions - start < interval_length ? (int) (max_instructions - start) : interval_length;
+	}
+	// Finish the functional run for the final state
+	functional_run(func, max_instructions - func->instructions);
+	return sim;
+}
+
+static void
+simulate_interval(APEX_PARALLEL* sim, APEX_INTERVAL* interval)
+{
+	APEX_CPU* cpu = APEX_cpu_init(sim->filename);
+	if (!cpu || (sim->data_image && mem_map_image(&cpu->data_memory, sim->data_image))
+	    || APEX_cpu_restore(cpu, &interval->checkpoint)) {
+		fprintf(stderr, "APEX_Error : Unable to start interval at instruction %lld\n", interval->start);
+		exit(1);
+	}
+	int measuring = interval->warmup == 0;
+	int start_clock = 0;
+	int start_mispredicts = 0;
+	int start_stack[NUM_CYCLE_CAUSES] = {0};
+	for (;;) {
+		if (!measuring && cpu->ins_completed >= interval->warmup) {
+			measuring = 1;
+			start_clock = cpu->clock;
+			start_mispredicts = cpu->branch_mispredicts;
+			memcpy(start_stack, cpu->cycle_stack, sizeof(start_stack));
+		}
+		if (measuring && cpu->ins_completed - interval->warmup >= interval->length) {
+			break;
+		}
+		if (APEX_cpu_cycle(cpu)) {
+			interval->halted = 1;
+			break;
+		}
+		if (sim->watchdog_cycles && cpu->clock - cpu->last_commit_clock >= sim->watchdog_cycles) {
+			interval->stuck = 1;
+			break;
+		}
+	}
+	if (measuring) {
+		interval->cycles = cpu->clock - start_clock;
+		interval->retired = cpu->ins_completed - interval->warmup;
+		interval->branch_mispredicts = cpu->branch_mispredicts - start_mispredicts;
+		for (int i = 0; i < NUM_CYCLE_CAUSES; i++) {
+			interval->cycle_stack[i] = cpu->cycle_stack[i] - start_stack[i];
+		}
+	}
+	interval->stage_profile = cpu->stage_profile;
+	APEX_cpu_stop(cpu);
+}
+
+static void*
+run_interval_thread(void* arg)
+{
+	APEX_PARALLEL* sim = arg;
+	for (;;) {
+		pthread_mutex_lock(&sim->lock);
+		int next = sim->next_interval++;
+		pthread_mutex_unlock(&sim->lock);
+		if (next >= sim->num_intervals) {
+			return NULL;
+		}
+		simulate_interval(sim, &sim->intervals[next]);
+	}
+}
+
+/*
+ * Simulates every interval on up to one host thread per host CPU, each
+ * thread taking the next unclaimed interval. Returns 1 if any interval
+ * was stopped by the watchdog.
+ */
+int
+parallel_run(APEX_PARALLEL* sim, int watchdog_cycles)
+{
+	long host_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	sim->num_threads = sim->num_intervals < host_cpus ? sim->num_intervals : (host_cpus > 0 ? host_cpus : 1);
+	if (sim->num_threads < 1) {
+		sim->num_threads = 1;
+	}
+	sim->watchdog_cycles = watchdog_cycles;
+	sim->next_interval = 0;
+	pthread_mutex_init(&sim->lock, NULL);
+
+	pthread_t* handles = malloc(sim->num_threads * sizeof(pthread_t));
+	if (!handles) {
+		fprintf(stderr, "APEX_Error : Out of memory starting interval threads\n");
+		exit(1);
+	}
+	// Thread 0 is the calling thread
+	for (int i = 1; i < sim->num_threads; i++) {
+		if (pthread_create(&handles[i], NULL, run_interval_thread, sim) != 0) {
+			fprintf(stderr, "APEX_Error : Unable to start interval thread %d\n", i);
+			exit(1);
+		}
+	}
+	run_interval_thread(sim);
+	for (int i = 1; i < sim->num_threads; i++) {
+		pthread_join(handles[i], NULL);
+	}
+	free(handles);
+	pthread_mutex_destroy(&sim->lock);
+
+	int stuck = 0;
+	for (int i = 0; i < sim->num_intervals; i++) {
+		stuck = stuck || sim->intervals[i].stuck;
+	}
+	return stuck;
+}
+
+/* Commits the interval must measure: its length, or up to the HALT the functional run reached */
+static long long
+expected_retired(APEX_PARALLEL* sim, APEX_INTERVAL* interval)
+{
+	long long to_halt = sim->functional.instructions - interval->start;
+	return sim->functional.halted && to_halt < interval->length ? to_halt : interval->length;
+}
+
+/*
+ * Prints the final state and every interval. The TOTAL and CPI stack
+ * are refused, returning 1, when an interval got stuck or retired fewer
+ * instructions than the functional run executed in it, since the sum
+ * would then be no estimate of the whole run.
+ */
+int
+parallel_print(APEX_PARALLEL* sim)
+{
+	APEX_FUNCTIONAL* func = &sim->functional;
+	printf("(apex) >> Simulation Complete, %d intervals on %d host threads, %lld instructions executed functionally\n",
+	       sim->num_intervals, sim->num_threads, func->instructions);
+	printf("=============== STATE OF ARCHITECTURAL REGISTER FILE ==========\n");
+	for (int index = 0; index < 15; ++index) {
+		printf("| \t REG[%d] \t | \t Value=%d \t | \t STATUS=VALID \t |\n", index, func->regs[index]);
+	}
+	print_memory(&func->memory);
+
+	printf("============== PER INTERVAL IPC =============\n");
+	long long cycles = 0;
+	long long retired = 0;
+	long long mispredicts = 0;
+	long long stack[NUM_CYCLE_CAUSES] = {0};
+	int incomplete = 0;
+	for (int i = 0; i < sim->num_intervals; i++) {
+		APEX_INTERVAL* interval = &sim->intervals[i];
+		int short_run = interval->retired < expected_retired(sim, interval);
+		incomplete = incomplete || interval->stuck || short_run;
+		printf("| \t INTERVAL[%d] \t | \t Start=%lld \t | \t Warmup=%d \t | \t Cycles=%d \t | \t Retired=%d \t |"
+		       " \t IPC=%.3f \t | \t Mispredicts=%d \t | \t %s \t |\n", i, interval->start, interval->warmup,
+		       interval->cycles, interval->retired, interval->cycles ? (double) interval->retired / interval->cycles : 0.0,
+		       interval->branch_mispredicts,
+		       interval->stuck ? "STUCK" : (short_run ? "SHORT" : (interval->halted ? "HALTED" : "COMPLETE")));
+		cycles += interval->cycles;
+		retired += interval->retired;
+		mispredicts += interval->branch_mispredicts;
+		for (int c = 0; c < NUM_CYCLE_CAUSES; c++) {
+			stack[c] += interval->cycle_stack[c];
+		}
+	}
+#ifdef APEX_STAGE_PROFILE
+	// Each interval counted on the host thread that simulated it
+	STAGE_PROFILE stage_profile = {{0}};
+	for (int i = 0; i < sim->num_intervals; i++) {
+		stage_profile_add(&stage_profile, &sim->intervals[i].stage_profile);
+	}
+	print_stage_profile(&stage_profile);
+#endif
+	if (incomplete) {
+		fprintf(stderr, "APEX_Error : An interval is STUCK or SHORT of the instructions it had to retire, no TOTAL or CPI stack\n");
+		return 1;
+	}
+	printf("| \t TOTAL \t | \t Cycles=%lld \t | \t Retired=%lld \t | \t IPC=%.3f \t | \t Mispredicts=%lld \t |\n",
+	       cycles, retired, cycles ? (double) retired / cycles : 0.0, mispredicts);
+	printf("============== CPI STACK =============\n");
+	printf("| \t Cycles=%lld \t | \t Retired=%lld \t | \t CPI=%.3f \t |\n", cycles, retired,
+	       retired ? (double) cycles / retired : 0.0);
+	for (int c = 0; c < NUM_CYCLE_CAUSES; c++) {
+		printf("| \t %-16s \t | \t Cycles=%lld \t | \t CPI=%.3f \t | \t %5.1f%% \t |\n", cycle_cause_name(c), stack[c],
+		       retired ? (double) stack[c] / retired : 0.0, cycles ? 100.0 * stack[c] / cycles : 0.0);
+	}
+	return 0;
+}
+
+void
+parallel_stop(APEX_PARALLEL* sim)
+{
+	for (int i = 0; i < sim->num_intervals; i++) {
+		checkpoint_free(&sim->intervals[i].checkpoint);
+	}
+	free(sim->intervals);
+	functional_free(&sim->functional);
+	free(sim);
+}
@@ -0,0 +1,65 @@
+#ifndef _APEX_PARALLEL_H_
+#define _APEX_PARALLEL_H_
+/**
+ *  parallel.h
+ *  Checkpointed interval simulation of one program on parallel host threads
+ *
+ *  A functional pass splits the run into intervals of interval_length
+ *  instructions and checkpoints the architectural state warmup
+ *  instructions before each one starts. Every interval is then
+ *  simulated in detail on its own APEX_CPU from its checkpoint: the
+ *  first warmup commits refill the ROB, BTB and queues and are not
+ *  counted, the next interval_length are. The per interval cycle counts
+ *  and CPI stacks add up to an estimate for the whole run.
+ */
+#include <pthread.h>
+
+#include "cpu.h"
+#include "functional.h"
+
+typedef struct APEX_INTERVAL
+{
+	APEX_CHECKPOINT checkpoint;
+	long long start;	// Instruction count at which measuring starts
+	int warmup;		// Commits from the checkpoint to start
+	int length;		// Commits measured
+
+	/* Detailed results, warm up excluded */
+	int cycles;
+	int retired;
+	int cycle_stack[NUM_CYCLE_CAUSES];
+	int branch_mispredicts;
+	int halted;		// HALT committed inside the interval
+	int stuck;		// Stopped by the watchdog
+	STAGE_PROFILE stage_profile;	// Host time per stage, warm up included
+} APEX_INTERVAL;
+
+typedef struct APEX_PARALLEL
+{
+	const char* filename;
+	const char* data_image;
+	int watchdog_cycles;
+	APEX_FUNCTIONAL functional;	// Holds the final architectural state
+	APEX_INTERVAL* intervals;
+	int num_intervals;
+
+	/* Run state shared by the host threads */
+	int num_threads;
+	int next_interval;
+	pthread_mutex_t lock;
+} APEX_PARALLEL;
+
+APEX_PARALLEL*
+parallel_init(const char* filename, const char* data_image, long long max_instructions,
+	      int interval_length, int warmup);
+
+int
+parallel_run(APEX_PARALLEL* sim, int watchdog_cycles);
+
+int
+parallel_print(APEX_PARALLEL* sim);
+
+void
+parallel_stop(APEX_PARALLEL* sim);
+
+#endif
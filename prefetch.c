@@ -0,0 +1,80 @@
+/*
+ *  prefetch.c
+ *  Next-line and per-PC stride data prefetchers
+ */
+#include <string.h>
+
+#include "prefetch.h"
+
+int
+prefetcher_init(PREFETCHER* prefetcher, const PREFETCH_CONFIG* config, L1_CACHE* cache)
+{
+	if ((config->kind != PREFETCH_NEXT_LINE && config->kind != PREFETCH_STRIDE)
+	    || config->degree < 1 || config->distance < 1 || !cache) {
+		return 1;
+	}
+	memset(prefetcher, 0, sizeof(*prefetcher));
+	prefetcher->config = *config;
+	prefetcher->cache = cache;
+	return 0;
+}
+
+const char*
+prefetch_kind_name(int kind)
+{
+	return kind == PREFETCH_STRIDE ? "STRIDE" : "NEXT-LINE";
+}
+
+/* Requests degree addresses step words apart, the first distance steps after address */
+static void
+prefetch_run(PREFETCHER* prefetcher, uint32_t address, int step, int clock)
+{
+	for (int i = 0; i < prefetcher->config.degree; i++) {
+		uint32_t target = address + (uint32_t) (step * (prefetcher->config.distance + i));
+		prefetcher->requests += 1;
+		l1_prefetch(prefetcher->cache, target, clock);
+	}
+}
+
+/*
+ * Trains on one access of the instruction at pc and requests the lines
+ * it predicts. Stride prefetches are only made once the PC has repeated
+ * a nonzero stride PREFETCH_CONFIDENT times in a row; strides shorter
+ * than a line are rounded up to a line so each request names a new one.
+ */
+void
+prefetcher_observe(PREFETCHER* prefetcher, int pc, uint32_t address, int clock)
+{
+	const int line_words = 1 << L1_LINE_BITS;
+	if (prefetcher->config.kind == PREFETCH_NEXT_LINE) {
+		prefetch_run(prefetcher, address & ~(uint32_t) (line_words - 1), line_words, clock);
+		return;
+	}
+	STRIDE_ENTRY* entry = &prefetcher->table[((uint32_t) pc / 4) % PREFETCH_TABLE_SIZE];
+	if (!entry->valid || entry->pc != pc) {
+		entry->valid = 1;
+		entry->pc = pc;
+		entry->last_address = address;
+		entry->stride = 0;
+		entry->confidence = 0;
+		return;
+	}
+	int stride = (int) (address - entry->last_address);
+	if (stride != 0 && stride == entry->stride) {
+		if (entry->confidence < PREFETCH_CONFIDENT) {
+			entry->confidence += 1;
+		}
+	} else {
+		entry->stride = stride;
+		entry->confidence = 0;
+	}
+	entry->last_address = address;
+	if (entry->confidence < PREFETCH_CONFIDENT) {
+		return;
+	}
+	int step = stride;
+	if (step > -line_words && step < line_words) {
+		step = step > 0 ? line_words : -line_words;
+	}
+	prefetch_run(prefetcher, address, step, clock);
+}
@@ -0,0 +1,63 @@
+#ifndef _APEX_PREFETCH_H_
+#define _APEX_PREFETCH_H_
+/**
+ *  prefetch.h
+ *  Hardware data prefetchers in front of a private L1
+ *
+ *  The prefetcher watches the address of every LOAD and STORE the LSQ
+ *  sends to the L1, keyed by the PC of the memory instruction, and asks
+ *  the L1 for lines it expects to be accessed soon. The next-line
+ *  prefetcher fetches the lines distance to distance + degree - 1 after
+ *  the accessed one. The stride prefetcher keeps the last address and
+ *  stride of each PC and, once a PC repeats its stride, fetches the
+ *  addresses distance to distance + degree - 1 strides ahead.
+ */
+#include <stdint.h>
+
+#include "coherence.h"
+
+#define PREFETCH_DEGREE 2	// Lines requested per access
+#define PREFETCH_DISTANCE 1	// Lines (next-line) or strides (stride) ahead of the access
+#define PREFETCH_TABLE_SIZE 16	// Stride table entries, direct mapped by PC
+#define PREFETCH_CONFIDENT 2	// Stride repeats before a PC prefetches
+
+enum PREFETCH_KIND
+{
+	PREFETCH_NEXT_LINE,
+	PREFETCH_STRIDE
+};
+
+typedef struct PREFETCH_CONFIG
+{
+	int kind;		// enum PREFETCH_KIND
+	int degree;
+	int distance;
+} PREFETCH_CONFIG;
+
+typedef struct STRIDE_ENTRY
+{
+	int pc;
+	uint32_t last_address;
+	int stride;
+	int confidence;		// Times in a row the stride repeated
+	int valid;
+} STRIDE_ENTRY;
+
+typedef struct PREFETCHER
+{
+	PREFETCH_CONFIG config;
+	L1_CACHE* cache;
+	STRIDE_ENTRY table[PREFETCH_TABLE_SIZE];
+	int requests;		// Addresses asked for, including lines already present
+} PREFETCHER;
+
+int
+prefetcher_init(PREFETCHER* prefetcher, const PREFETCH_CONFIG* config, L1_CACHE* cache);
+
+void
+prefetcher_observe(PREFETCHER* prefetcher, int pc, uint32_t address, int clock);
+
+const char*
+prefetch_kind_name(int kind);
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef _APEX_SIMD_H_
+#define _APEX_SIMD_H_
+/**
+ *  simd.h
+ *  Packed lane arithmetic of the vector instructions on host SIMD
+ *
+ *  A vector register is a group of VLEN consecutive architectural
+ *  registers starting at a multiple of VLEN: V0 is R0-R3, V1 R4-R7, V2
+ *  R8-R11 and V3 R12-R15. VADD, VSUB, VMUL and VAND combine two groups
+ *  lane by lane into a third, VLOAD and VSTORE move a group from and to
+ *  VLEN consecutive words of data memory. The lanes are computed with
+ *  GCC vector extensions, one host SIMD instruction per operation where
+ *  the host has them.
+ */
+#include <stdint.h>
+#include <string.h>
+
+#define VLEN 4
+
+/* Lanes are unsigned so they wrap on overflow like the two's complement scalar ALU */
+typedef uint32_t SIMD_LANES __attribute__((vector_size(VLEN * sizeof(uint32_t))));
+
+enum SIMD_OP
+{
+	SIMD_ADD,
+	SIMD_SUB,
+	SIMD_MUL,
+	SIMD_AND,
+	NUM_SIMD_OPS
+};
+
+/* Lane operation of a VADD/VSUB/VMUL/VAND opcode, -1 for any other opcode */
+static inline int
+simd_op(const char* opcode)
+{
+	static const char* names[NUM_SIMD_OPS] = {"VADD", "VSUB", "VMUL", "VAND"};
+	if (opcode[0] != 'V') {
+		return -1;
+	}
+	for (int op = 0; op < NUM_SIMD_OPS; op++) {
+		if (strcmp(opcode, names[op]) == 0) {
+			return op;
+		}
+	}
+	return -1;
+}
+
+/* result[i] = a[i] op b[i] for each of the VLEN lanes; result may alias a or b */
+static inline void
+simd_execute(int op, const int* a, const int* b, int* result)
+{
+	SIMD_LANES x, y, r;
+	memcpy(&x, a, sizeof(x));
+	memcpy(&y, b, sizeof(y));
+	switch (op) {
+	case SIMD_ADD:
+		r = x + y;
+		break;
+	case SIMD_SUB:
+		r = x - y;
+		break;
+	case SIMD_MUL:
+		r = x * y;
+		break;
+	default:
+		r = x & y;
+		break;
+	}
+	memcpy(result, &r, sizeof(r));
+}
+
+#endif
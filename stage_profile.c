@@ -0,0 +1,56 @@
+/*
+ *  stage_profile.c
+ *  Counters and report for the per-stage host time profile
+ */
+#include <stdio.h>
+#include <time.h>
+
+#include "stage_profile.h"
+
+#ifdef APEX_STAGE_PROFILE
+
+static const char* profiled_stage_names[NUM_PROFILED_STAGES] = {
+	"instruction_retirement", "memory_issue", "branch_fu", "writeToLSQ",
+	"mul_fu_3", "mul_fu_2", "mul_fu_1", "int_fu_2", "int_fu_1",
+	"issue_queue", "decode", "fetch", "flush"
+};
+
+#if !defined(__x86_64__) && !defined(__i386__)
+/* No TSC, fall back to the monotonic clock in nanoseconds */
+uint64_t
+stage_clock(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t) now.tv_sec * 1000000000u + now.tv_nsec;
+}
+#endif
+
+/* Adds the counters of profile to total, once the CPU that filled profile has stopped */
+void
+stage_profile_add(STAGE_PROFILE* total, const STAGE_PROFILE* profile)
+{
+	for (int i = 0; i < NUM_PROFILED_STAGES; i++) {
+		total->ticks[i] += profile->ticks[i];
+		total->calls[i] += profile->calls[i];
+	}
+}
+
+void
+print_stage_profile(const STAGE_PROFILE* profile)
+{
+	uint64_t total = 0;
+	for (int i = 0; i < NUM_PROFILED_STAGES; i++) {
+		total += profile->ticks[i];
+	}
+	printf("============== HOST TIME PER STAGE =============\n");
+	for (int i = 0; i < NUM_PROFILED_STAGES; i++) {
+		printf("| \t %-22s \t | \t Calls=%llu \t | \t Ticks=%llu \t | \t Ticks/call=%.1f \t | \t %5.1f%% \t |\n",
+		       profiled_stage_names[i], (unsigned long long) profile->calls[i],
+		       (unsigned long long) profile->ticks[i],
+		       profile->calls[i] ? (double) profile->ticks[i] / profile->calls[i] : 0.0,
+		       total ? 100.0 * profile->ticks[i] / total : 0.0);
+	}
+}
+
+#endif
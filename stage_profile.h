@@ -0,0 +1,72 @@
+#ifndef _APEX_STAGE_PROFILE_H_
+#define _APEX_STAGE_PROFILE_H_
+/**
+ *  stage_profile.h
+ *  Host time spent in each stage function of APEX_cpu_run
+ *
+ *  Built with APEX_STAGE_PROFILE ('make STAGE_PROFILE=1'), every stage
+ *  call is bracketed by two reads of the host cycle counter and counted
+ *  in the STAGE_PROFILE of the CPU making it, so cores and intervals on
+ *  different host threads never share counters; runs with several CPUs
+ *  sum theirs with stage_profile_add before printing. Without it
+ *  STAGE_TIMED is the bare call and the table is never printed.
+ */
+#include <stdint.h>
+
+enum PROFILED_STAGE
+{
+	PROF_RETIRE,
+	PROF_MEMORY,
+	PROF_BRANCH,
+	PROF_WRITE_LSQ,
+	PROF_MUL3,
+	PROF_MUL2,
+	PROF_MUL1,
+	PROF_INT2,
+	PROF_INT1,
+	PROF_ISSUE,
+	PROF_DECODE,
+	PROF_FETCH,
+	PROF_FLUSH,
+	NUM_PROFILED_STAGES
+};
+
+typedef struct STAGE_PROFILE
+{
+	uint64_t ticks[NUM_PROFILED_STAGES];
+	uint64_t calls[NUM_PROFILED_STAGES];
+} STAGE_PROFILE;
+
+#ifdef APEX_STAGE_PROFILE
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define stage_clock() __rdtsc()
+#else
+uint64_t
+stage_clock(void);
+#endif
+
+#define STAGE_TIMED(profile, id, call) \
+	do { \
+		uint64_t stage_start = stage_clock(); \
+		call; \
+		(profile)->ticks[id] += stage_clock() - stage_start; \
+		(profile)->calls[id] += 1; \
+	} while (0)
+
+void
+stage_profile_add(STAGE_PROFILE* total, const STAGE_PROFILE* profile);
+
+void
+print_stage_profile(const STAGE_PROFILE* profile);
+
+#else
+
+#define STAGE_TIMED(profile, id, call) call
+#define stage_profile_add(total, profile) ((void) 0)
+#define print_stage_profile(profile) ((void) 0)
+
+#endif
+
+#endif
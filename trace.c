@@ -0,0 +1,53 @@
+/*
+ *  trace.c
+ *  Contains the writer side of the binary pipeline trace
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "trace.h"
+
+APEX_TRACE*
+trace_open(const char* filename)
+{
+	APEX_TRACE* trace = malloc(sizeof(*trace));
+	if (!trace) {
+		return NULL;
+	}
+	trace->fp = fopen(filename, "wb");
+	if (!trace->fp) {
+		free(trace);
+		return NULL;
+	}
+	trace->count = 0;
+
+	TRACE_HEADER header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC));
+	header.version = TRACE_VERSION;
+	header.event_size = sizeof(TRACE_EVENT);
+	fwrite(&header, sizeof(header), 1, trace->fp);
+	return trace;
+}
+
+/* Writes the buffered events out and empties the buffer */
+void
+trace_drain(APEX_TRACE* trace)
+{
+	if (trace->count > 0) {
+		fwrite(trace->events, sizeof(TRACE_EVENT), trace->count, trace->fp);
+		trace->count = 0;
+	}
+}
+
+void
+trace_close(APEX_TRACE* trace)
+{
+	if (!trace) {
+		return;
+	}
+	trace_drain(trace);
+	fclose(trace->fp);
+	free(trace);
+}
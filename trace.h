@@ -0,0 +1,81 @@
+#ifndef _APEX_TRACE_H_
+#define _APEX_TRACE_H_
+/**
+ *  trace.h
+ *  Binary per-instruction pipeline trace
+ *
+ *  Events are appended to an in-memory buffer and written out in bulk
+ *  whenever it fills up, so recording an event is a handful of stores.
+ */
+#include <stdint.h>
+#include <stdio.h>
+
+#define TRACE_MAGIC "APEXTRC"
+#define TRACE_VERSION 1
+#define TRACE_BUFFER_EVENTS (1 << 16)
+
+enum TRACE_EVENT_TYPE
+{
+	TRACE_FETCH,
+	TRACE_RENAME,
+	TRACE_DISPATCH,
+	TRACE_ISSUE,
+	TRACE_COMPLETE,
+	TRACE_COMMIT,
+	TRACE_SQUASH,
+	NUM_TRACE_EVENTS
+};
+
+/* One lifecycle event of one dynamic instruction, 12 bytes on disk */
+typedef struct TRACE_EVENT
+{
+	uint32_t cycle;
+	uint32_t seq;		// Dynamic instruction number, assigned at fetch
+	uint16_t code_index;	// get_code_index of the instruction's PC
+	uint8_t type;		// enum TRACE_EVENT_TYPE
+	uint8_t reserved;
+} TRACE_EVENT;
+
+/* File header, followed by TRACE_EVENT records until end of file */
+typedef struct TRACE_HEADER
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t event_size;
+} TRACE_HEADER;
+
+typedef struct APEX_TRACE
+{
+	FILE* fp;
+	int count;
+	TRACE_EVENT events[TRACE_BUFFER_EVENTS];
+} APEX_TRACE;
+
+APEX_TRACE*
+trace_open(const char* filename);
+
+void
+trace_drain(APEX_TRACE* trace);
+
+void
+trace_close(APEX_TRACE* trace);
+
+/* Records one event; a no-op when tracing is off (trace == NULL) */
+static inline void
+trace_event(APEX_TRACE* trace, int type, int seq, int pc, int cycle)
+{
+	if (!trace) {
+		return;
+	}
+	TRACE_EVENT* event = &trace->events[trace->count];
+	event->cycle = cycle;
+	event->seq = seq;
+	event->code_index = (pc - 4000) / 4;
+	event->type = type;
+	event->reserved = 0;
+	if (++trace->count == TRACE_BUFFER_EVENTS) {
+		trace_drain(trace);
+	}
+}
+
+#endif
@@ -0,0 +1,123 @@
+/*
+ *  trace2o3.c
+ *  Converts a binary APEX pipeline trace (see trace.h) into the gem5
+ *  O3PipeView text format, which Konata and the gem5 o3-pipeview
+ *  script both read.
+ *
+ *  Usage : apex_trace2o3 <trace_file> <input_file> [output_file]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cpu.h"
+#include "trace.h"
+
+/* Cycle N is written as tick (N + 1) * TICKS_PER_CYCLE, keeping tick 0 for "never happened" */
+#define TICKS_PER_CYCLE 1000
+/* Instructions in flight at once; far above ROB_SIZE plus the front end */
+#define WINDOW_SIZE 4096
+
+typedef struct INS_RECORD
+{
+	int valid;
+	uint32_t seq;
+	uint16_t code_index;
+	unsigned long long tick[NUM_TRACE_EVENTS];
+} INS_RECORD;
+
+static INS_RECORD window[WINDOW_SIZE];
+
+static void
+emit_record(FILE* out, INS_RECORD* record, APEX_Instruction* code_memory, int code_memory_size)
+{
+	char text[64] = "???";
+	if (record->code_index < code_memory_size) {
+		int length = format_instruction(text, sizeof(text), &code_memory[record->code_index]);
+		while (length > 0 && text[length - 1] == ' ') {
+			text[--length] = '\0';
+		}
+	}
+	unsigned long long* tick = record->tick;
+	// A squashed instruction never retires
+	unsigned long long retire = tick[TRACE_SQUASH] ? 0 : tick[TRACE_COMMIT];
+	fprintf(out, "O3PipeView:fetch:%llu:0x%08x:0:%u:%s\n", tick[TRACE_FETCH],
+			4000 + record->code_index * 4, record->seq, text);
+	fprintf(out, "O3PipeView:decode:%llu\n", tick[TRACE_RENAME]);
+	fprintf(out, "O3PipeView:rename:%llu\n", tick[TRACE_RENAME]);
+	fprintf(out, "O3PipeView:dispatch:%llu\n", tick[TRACE_DISPATCH]);
+	fprintf(out, "O3PipeView:issue:%llu\n", tick[TRACE_ISSUE]);
+	fprintf(out, "O3PipeView:complete:%llu\n", tick[TRACE_COMPLETE]);
+	fprintf(out, "O3PipeView:retire:%llu:store:%llu\n", retire, 0ULL);
+	record->valid = 0;
+}
+
+int
+main(int argc, char const* argv[])
+{
+	if (argc < 3 || argc > 4) {
+		fprintf(stderr, "APEX_Help : Usage %s <trace_file> <input_file> [output_file]\n", argv[0]);
+		exit(1);
+	}
+	FILE* in = fopen(argv[1], "rb");
+	if (!in) {
+		fprintf(stderr, "APEX_Error : Unable to open trace %s\n", argv[1]);
+		exit(1);
+	}
+	TRACE_HEADER header;
+	if (fread(&header, sizeof(header), 1, in) != 1 || memcmp(header.magic, TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0
+			|| header.version != TRACE_VERSION || header.event_size != sizeof(TRACE_EVENT)) {
+		fprintf(stderr, "APEX_Error : %s is not an APEX trace\n", argv[1]);
+		exit(1);
+	}
+	int code_memory_size = 0;
+	APEX_Instruction* code_memory = create_code_memory(argv[2], &code_memory_size);
+	if (!code_memory) {
+		fprintf(stderr, "APEX_Error : Unable to read %s\n", argv[2]);
+		exit(1);
+	}
+	FILE* out = argc == 4 ? fopen(argv[3], "w") : stdout;
+	if (!out) {
+		fprintf(stderr, "APEX_Error : Unable to open %s\n", argv[3]);
+		exit(1);
+	}
+
+	static TRACE_EVENT events[TRACE_BUFFER_EVENTS];
+	size_t count;
+	while ((count = fread(events, sizeof(TRACE_EVENT), TRACE_BUFFER_EVENTS, in)) > 0) {
+		for (size_t i = 0; i < count; i++) {
+			TRACE_EVENT* event = &events[i];
+			if (event->type >= NUM_TRACE_EVENTS) {
+				continue;
+			}
+			INS_RECORD* record = &window[event->seq % WINDOW_SIZE];
+			if (record->valid && record->seq != event->seq) {
+				// Never retired or squashed within the window, flush it as is
+				emit_record(out, record, code_memory, code_memory_size);
+			}
+			if (!record->valid) {
+				memset(record, 0, sizeof(*record));
+				record->valid = 1;
+				record->seq = event->seq;
+				record->code_index = event->code_index;
+			}
+			record->tick[event->type] = (unsigned long long) (event->cycle + 1) * TICKS_PER_CYCLE;
+			if (event->type == TRACE_COMMIT || event->type == TRACE_SQUASH) {
+				emit_record(out, record, code_memory, code_memory_size);
+			}
+		}
+	}
+	// Whatever is left was still in flight when the simulation stopped
+	for (int i = 0; i < WINDOW_SIZE; i++) {
+		if (window[i].valid) {
+			emit_record(out, &window[i], code_memory, code_memory_size);
+		}
+	}
+
+	if (out != stdout) {
+		fclose(out);
+	}
+	fclose(in);
+	free(code_memory);
+	return 0;
+}